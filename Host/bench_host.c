@@ -0,0 +1,250 @@
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* LCD bus traffic benchmark (host build)
+* Plays scripted game scenes through the real drawing code in function.c,
+* the same calls as the frame loop in main.c, against the ST7565 emulator.
+* For every scene it reports the command writes, data writes, reads and
+* HAL_Delay() calls per frame and the bus time they take at the FSMC timing
+* LCD_FSMCConfig() programs. Results are written as CSV. The run fails when
+* the worst frame of a scene needs more bus time or delays than its budget.
+*
+*   make -C Host bench                     writes Host/out/bench.csv
+*   ./bench_host <csv> [cycles per access] default: LCD_GetBusCycles()
+*******************************************************************************/
+
+#define BENCH_OBSTACLES  3   // as MAX_OBSTACLES in main.c
+
+typedef struct
+{
+  const char *name;
+  unsigned int frames;
+  unsigned char speed;          // scroll speed, 1/16 pixel per frame
+  unsigned char spawnEvery;     // frames between obstacles, 0: none
+  unsigned char jumpEvery;      // frames between jumps, 0: none
+  unsigned char hitEvery;       // frames between hits (flash, blink), 0: none
+  unsigned long budgetUs;       // bus time allowed for the worst frame
+  unsigned long budgetDelays;   // HAL_Delay() calls allowed per frame
+} BenchSceneTypeDef;
+
+typedef struct
+{
+  unsigned long commands, dataWrites, dataReads, delays;
+  unsigned long long cycles, worstCycles;
+  unsigned long worstDelays;
+} BenchResultTypeDef;
+
+// Budgets are the current worst frame at the board's HCLK (8 MHz HSI, 3
+// cycles per access) plus about 50%, so a rendering regression fails while
+// the bus time is still a small part of the ~36.9 ms frame (FRAME_US)
+static const BenchSceneTypeDef BenchScenes[] = {
+  // name          frames speed               spawn jump  hit budget delays
+  {"entry",            1, 0,                    0,  0,    0,  135, 16},  // one frame = whole animation
+  {"run",            240, SCROLL_SPEED_INIT,    0,  0,    0,  115,  0},
+  {"jump",           240, SCROLL_SPEED_INIT,    0, 40,    0,  140,  0},
+  {"obstacles",      480, SCROLL_SPEED_INIT,   45, 50,    0,  175,  0},
+  {"max_speed",      480, SCROLL_SPEED_MAX,    30, 35,    0,  170,  0},
+  {"hit",            480, SCROLL_SPEED_INIT,   45, 50,  160,  175,  0},
+};
+
+static DinoGameState Game;
+static Obstacle Obstacles[BENCH_OBSTACLES];
+static unsigned long AccessCycles;
+
+static unsigned long long toMicros(unsigned long long cycles)
+{
+  return cycles * 1000000ULL / HAL_RCC_GetHCLKFreq();
+}
+
+// Start of a scene: the screen main.c shows when a game starts
+static void setupScene(const BenchSceneTypeDef *scene)
+{
+  LCD_Clear();
+  initGameState(&Game);
+  memset(Obstacles, 0, sizeof(Obstacles));
+  if (scene->frames > 1)
+  {
+    animateGroundLineEntry(GROUND_PAGE, &Game);
+    drawSky(&Game);
+    drawHud(&Game, 0);
+    LCD_Flush();
+  }
+  Game.scrollSpeed = scene->speed;
+}
+
+// One iteration of the frame loop in main.c, with scripted input and spawns
+static void playFrame(const BenchSceneTypeDef *scene, unsigned int frame)
+{
+  static const unsigned char types[4] = {0, 2, 1, 3};
+  unsigned char oldDinoRow = Game.dinoRow;
+  unsigned char oldDinoY = Game.dinoY;
+  unsigned int prevScrollPos;
+  unsigned char scrollPixels;
+  int i;
+
+  if (scene->frames == 1)
+  {
+    animateGroundLineEntry(GROUND_PAGE, &Game);
+    return;
+  }
+
+  if (scene->jumpEvery && frame % scene->jumpEvery == 0 && !Game.isJumping && Game.jumpHeight == 0)
+    Game.isJumping = 1;
+  handleJump(&Game);
+  updateDinoAnimation(&Game);
+
+  clearSpriteAt(oldDinoRow, oldDinoY, 2);
+  for (i = 0; i < BENCH_OBSTACLES; i++)
+    if (Obstacles[i].active)
+      clearSpriteAt(Obstacles[i].x * 8, Obstacles[i].y, 2);
+
+  if (scene->spawnEvery && frame % scene->spawnEvery == 0)
+  {
+    for (i = 0; i < BENCH_OBSTACLES; i++)
+    {
+      if (!Obstacles[i].active)
+      {
+        Obstacles[i].type = types[(frame / scene->spawnEvery) % 4];
+        Obstacles[i].y = 128;
+        Obstacles[i].animFrame = 0;
+        if (Obstacles[i].type == 2)
+          Obstacles[i].x = BIRD_FLIGHT_PAGE;
+        else if (Obstacles[i].type == 3)
+          Obstacles[i].x = BIRD_LOW_FLIGHT_PAGE;
+        else
+          Obstacles[i].x = GROUND_PAGE - GROUND_OFFSET;
+        Obstacles[i].active = 1;
+        break;
+      }
+    }
+  }
+
+  prevScrollPos = Game.scrollPos;
+  scrollPixels = updateScroll(&Game);
+  moveSky(&Game, prevScrollPos);
+  for (i = 0; i < BENCH_OBSTACLES; i++)
+  {
+    if (Obstacles[i].active && scrollPixels)
+    {
+      Obstacles[i].y -= scrollPixels;
+      Obstacles[i].animFrame += scrollPixels;
+      if (Obstacles[i].y <= -16)
+      {
+        Obstacles[i].active = 0;
+        Game.score++;
+        drawGameScore(Game.score);
+      }
+    }
+  }
+
+  if (scrollPixels)
+    drawScrollingGround(GROUND_PAGE, &Game);
+  for (i = 0; i < BENCH_OBSTACLES; i++)
+  {
+    if (!Obstacles[i].active)
+      continue;
+    if (Obstacles[i].type == 2 || Obstacles[i].type == 3)
+      drawBird(Obstacles[i].x, Obstacles[i].y, Obstacles[i].animFrame / 8);  // flaps every 32 pixels
+    else
+      drawCactus(Obstacles[i].x, Obstacles[i].y, Obstacles[i].type);
+  }
+  drawDino(&Game);
+
+  if (scene->hitEvery && frame % scene->hitEvery == scene->hitEvery - 1)
+    startHitEffect(&Game);
+  updateHitEffect(&Game);
+
+  LCD_SwapBuffers();
+  LCD_FlushWait();
+}
+
+static void runScene(const BenchSceneTypeDef *scene, BenchResultTypeDef *result)
+{
+  unsigned long long cycles;
+  unsigned long delays;
+  unsigned int frame;
+
+  memset(result, 0, sizeof(*result));
+  setupScene(scene);
+
+  for (frame = 0; frame < scene->frames; frame++)
+  {
+    ST7565_ResetStats();
+    Host_DelayCalls = 0;
+
+    playFrame(scene, frame);
+
+    cycles = (unsigned long long)(ST7565_Stats.commands + ST7565_Stats.dataWrites +
+                                  ST7565_Stats.dataReads) * AccessCycles;
+    delays = Host_DelayCalls;
+    result->commands += ST7565_Stats.commands;
+    result->dataWrites += ST7565_Stats.dataWrites;
+    result->dataReads += ST7565_Stats.dataReads;
+    result->delays += delays;
+    result->cycles += cycles;
+    if (cycles > result->worstCycles)
+      result->worstCycles = cycles;
+    if (delays > result->worstDelays)
+      result->worstDelays = delays;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  const char *csvPath = argc > 1 ? argv[1] : "bench.csv";
+  const BenchSceneTypeDef *scene;
+  BenchResultTypeDef result;
+  unsigned int n, failed = 0;
+  unsigned long long worstUs;
+  double frames;
+  FILE *csv;
+
+  ST7565_Reset();
+  LCD_Init();
+  AccessCycles = LCD_GetBusCycles();
+  if (argc > 2)
+    sscanf(argv[2], "%lu", &AccessCycles);
+
+  csv = fopen(csvPath, "w");
+  if (csv == NULL)
+  {
+    printf("cannot write %s\n", csvPath);
+    return 2;
+  }
+
+  printf("HCLK %lu Hz, %lu cycles per bus access\n\n",
+         (unsigned long)HAL_RCC_GetHCLKFreq(), AccessCycles);
+  printf("%-10s %6s %9s %9s %7s %7s %8s %8s %8s\n",
+         "scene", "frames", "cmd/f", "write/f", "read/f", "delay/f", "us/f", "worst", "budget");
+  fprintf(csv, "scene,frames,commands_per_frame,data_writes_per_frame,data_reads_per_frame,"
+               "delays_per_frame,bus_us_per_frame,worst_bus_us,budget_us,result\n");
+
+  for (n = 0; n < sizeof(BenchScenes) / sizeof(BenchScenes[0]); n++)
+  {
+    scene = &BenchScenes[n];
+    runScene(scene, &result);
+
+    frames = scene->frames;
+    worstUs = toMicros(result.worstCycles);
+    if (worstUs > scene->budgetUs || result.worstDelays > scene->budgetDelays)
+      failed++;
+
+    printf("%-10s %6u %9.1f %9.1f %7.1f %7.2f %8.1f %8llu %8lu%s\n",
+           scene->name, scene->frames, result.commands / frames, result.dataWrites / frames,
+           result.dataReads / frames, result.delays / frames, toMicros(result.cycles) / frames,
+           worstUs, scene->budgetUs,
+           worstUs > scene->budgetUs ? "  OVER BUDGET" :
+           result.worstDelays > scene->budgetDelays ? "  TOO MANY DELAYS" : "");
+    fprintf(csv, "%s,%u,%.1f,%.1f,%.1f,%.2f,%.1f,%llu,%lu,%s\n",
+            scene->name, scene->frames, result.commands / frames, result.dataWrites / frames,
+            result.dataReads / frames, result.delays / frames, toMicros(result.cycles) / frames,
+            worstUs, scene->budgetUs,
+            (worstUs > scene->budgetUs || result.worstDelays > scene->budgetDelays) ? "fail" : "pass");
+  }
+
+  fclose(csv);
+  printf("\n%s: %u scene(s) over budget\n", failed ? "FAIL" : "PASS", failed);
+  return failed ? 1 : 0;
+}
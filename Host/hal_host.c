@@ -0,0 +1,68 @@
+#include "stm32f1xx_hal.h"
+
+/*******************************************************************************
+* Host build HAL shim: peripherals the LCD driver configures do not exist on
+* the PC, so their setup functions do nothing
+*******************************************************************************/
+static GPIO_TypeDef HostGpio[7];
+static DMA_Channel_TypeDef HostDmaChannel;
+static uint32_t HostTick;
+unsigned long Host_DelayCalls;
+
+GPIO_TypeDef *GPIOA = &HostGpio[0];
+GPIO_TypeDef *GPIOB = &HostGpio[1];
+GPIO_TypeDef *GPIOC = &HostGpio[2];
+GPIO_TypeDef *GPIOD = &HostGpio[3];
+GPIO_TypeDef *GPIOE = &HostGpio[4];
+GPIO_TypeDef *GPIOF = &HostGpio[5];
+GPIO_TypeDef *GPIOG = &HostGpio[6];
+DMA_Channel_TypeDef *DMA1_Channel6 = &HostDmaChannel;
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void)
+{
+  return HOST_HCLK_FREQ;
+}
+
+// Delays only advance the tick and are counted, the emulated controller
+// never needs to wait
+uint32_t HAL_GetTick(void)
+{
+  return HostTick;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  HostTick += Delay;
+  Host_DelayCalls++;
+}
+
+HAL_StatusTypeDef HAL_SRAM_Init(SRAM_HandleTypeDef *hsram, FSMC_NORSRAM_TimingTypeDef *Timing,
+                                FSMC_NORSRAM_TimingTypeDef *ExtTiming)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+  return HAL_OK;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+}
@@ -0,0 +1,244 @@
+#include "lcd.h"
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Host build of the LCD driver
+* Runs lcd.c against the ST7565 emulator, writes the panel output of a few
+* scenes as PBM and PNG images and prints the bus traffic of each step, so
+* rendering changes can be checked and measured without the board. Every
+* step gets a checksum of the panel; with -r the checksums are compared with
+* a reference file and the run fails on any difference, or when the driver's
+* bus counters disagree with the emulator. -w writes a new reference.
+*
+*   make -C Host run                          images go to Host/out/, checked
+*   make -C Host ref                          accept the current output
+*   ./lcd_host [-r|-w reference] <dir> [scale]   scale: pixels per LCD dot, default 4
+*******************************************************************************/
+
+#define REF_STEPS  32
+
+typedef struct
+{
+  char name[16];
+  unsigned long checksum;
+  unsigned char seen;
+} RefStepTypeDef;
+
+static const char *OutDir = ".";
+static unsigned int Scale = 4;
+static RefStepTypeDef RefSteps[REF_STEPS];
+static unsigned int RefCount;
+static FILE *RefOut;
+static unsigned int Failures;
+
+// FNV-1a over the panel as it is seen, one byte per 8 dots of a line
+static unsigned long panelChecksum(void)
+{
+  unsigned long hash = 2166136261UL;
+  unsigned char x, y, bits = 0;
+
+  for (y = 0; y < ST7565_LINES; y++)
+  {
+    for (x = 0; x < ST7565_SEGMENTS; x++)
+    {
+      bits = (bits << 1) | ST7565_GetPixel(x, y);
+      if ((x & 7) == 7)
+        hash = ((hash ^ bits) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+  }
+  return hash;
+}
+
+// Read "name checksum" lines of a reference written with -w
+static int loadReference(const char *path)
+{
+  FILE *f = fopen(path, "r");
+
+  if (f == NULL)
+    return -1;
+  while (RefCount < REF_STEPS &&
+         fscanf(f, "%15s %lx", RefSteps[RefCount].name, &RefSteps[RefCount].checksum) == 2)
+    RefCount++;
+  fclose(f);
+  return 0;
+}
+
+// Compare the checksum of a step with the reference, if one was loaded
+static void checkReference(const char *name, unsigned long checksum)
+{
+  unsigned int n;
+
+  if (RefOut != NULL)
+    fprintf(RefOut, "%s %08lx\n", name, checksum);
+  if (RefCount == 0)
+    return;
+
+  for (n = 0; n < RefCount; n++)
+    if (strcmp(RefSteps[n].name, name) == 0)
+      break;
+  if (n == RefCount)
+  {
+    printf("%-10s not in the reference\n", name);
+    Failures++;
+  }
+  else
+  {
+    RefSteps[n].seen = 1;
+    if (RefSteps[n].checksum != checksum)
+    {
+      printf("%-10s panel differs from the reference (%08lx)\n", name, RefSteps[n].checksum);
+      Failures++;
+    }
+  }
+}
+
+// Write the panel output of a step and print what it cost on the bus
+static void report(const char *name)
+{
+  char path[512];
+  unsigned long checksum = panelChecksum();
+
+  snprintf(path, sizeof(path), "%s/%s.pbm", OutDir, name);
+  if (ST7565_SavePBM(path, Scale) != 0)
+    printf("cannot write %s\n", path);
+  snprintf(path, sizeof(path), "%s/%s.png", OutDir, name);
+  if (ST7565_SavePNG(path, Scale) != 0)
+    printf("cannot write %s\n", path);
+
+  printf("%-10s %9lu %9lu %9lu %11llu %9llu  %08lx\n", name,
+         ST7565_Stats.commands, ST7565_Stats.dataWrites, ST7565_Stats.dataReads,
+         ST7565_Stats.cycles, ST7565_Stats.cycles * 1000000ULL / HAL_RCC_GetHCLKFreq(),
+         checksum);
+
+  // the driver's own counters must agree with what the controller saw
+  if (LCD_BusStats.commands != ST7565_Stats.commands ||
+      LCD_BusStats.dataWrites != ST7565_Stats.dataWrites ||
+      LCD_BusStats.dataReads != ST7565_Stats.dataReads)
+  {
+    printf("%-10s LCD_BusStats differ: %lu/%lu/%lu\n", name,
+           LCD_BusStats.commands, LCD_BusStats.dataWrites, LCD_BusStats.dataReads);
+    Failures++;
+  }
+  checkReference(name, checksum);
+
+  LCD_ResetBusStats();
+  ST7565_ResetStats();
+}
+
+int main(int argc, char *argv[])
+{
+  const unsigned char *dino = LCD_SpriteFrame(SPRITE_DINO_STAND, 0);
+  unsigned int n;
+  int x, arg = 1;
+
+  if (argc > arg + 1 && strcmp(argv[arg], "-r") == 0)
+  {
+    if (loadReference(argv[arg + 1]) != 0 || RefCount == 0)
+    {
+      printf("cannot read reference %s\n", argv[arg + 1]);
+      return 2;
+    }
+    arg += 2;
+  }
+  else if (argc > arg + 1 && strcmp(argv[arg], "-w") == 0)
+  {
+    RefOut = fopen(argv[arg + 1], "w");
+    if (RefOut == NULL)
+    {
+      printf("cannot write reference %s\n", argv[arg + 1]);
+      return 2;
+    }
+    arg += 2;
+  }
+  if (argc > arg)
+    OutDir = argv[arg];
+  if (argc > arg + 1)
+    sscanf(argv[arg + 1], "%u", &Scale);
+
+  ST7565_Reset();
+  LCD_FSMCConfig();
+  ST7565_SetAccessCycles(LCD_GetBusCycles());
+  printf("HCLK %lu Hz, %lu cycles per bus access\n\n",
+         (unsigned long)HAL_RCC_GetHCLKFreq(), LCD_GetBusCycles());
+  printf("%-10s %9s %9s %9s %11s %9s  %-8s\n", "step", "commands", "writes", "reads", "cycles", "us",
+         "checksum");
+
+  // init sequence, blank screen and the ST logo
+  LCD_Init();
+  report("logo");
+
+  // the same logo inverted by the blitter, the table itself is const
+  Converse_Logo();
+  LCD_Draw_ST_Logo();
+  Converse_Logo();
+  report("logo_inv");
+
+  // text and primitives on the background, a sprite on the playfield
+  LCD_Clear();
+  LCD_ResetBusStats();
+  ST7565_ResetStats();
+  LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+  LCD_DrawText(0, LCD_TEXT_CENTER, "ST7565");
+  LCD_DrawRect(0, 20, 127, 63, 1);
+  LCD_DrawCircle(100, 42, 14, 1);
+  LCD_FillTriangle(10, 60, 30, 30, 50, 60, 1);
+  LCD_DrawLineAngle(0, 20, 127, 63, 1);
+  LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+  LCD_BlitString(60, 37, dino, 2, LCD_BLIT_OR);
+  LCD_Flush();
+  report("scene");
+
+  // move the sprite one pixel per frame, only the changed columns are sent
+  for (x = 60; x < 92; x++)
+  {
+    LCD_SetArea(x, 37, x + 15, 52, 0);
+    LCD_BlitString(x + 1, 37, dino, 2, LCD_BLIT_OR);
+    LCD_SwapBuffers();
+  }
+  LCD_FlushWait();
+  report("sprite32");
+
+  // direct display RAM fill with partial pages in RMW mode
+  LCD_DirectSetArea(4, 3, 40, 18, 1);
+  report("direct");
+
+  // HUD font: a line per page, each one partial-page run
+  LCD_Clear();
+  LCD_ResetBusStats();
+  ST7565_ResetStats();
+  LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+  LCD_SmallPrintf(0, 0, "LIFE %u", 3);
+  LCD_SmallPrintf(0, LCD_TEXT_RIGHT, "HI %u %u", 120, 42);
+  LCD_DrawSmallText(2, 0, "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+  LCD_DrawSmallText(3, 0, "0123456789 :.-+/!?");
+  LCD_DrawSmallText(5, LCD_TEXT_CENTER, "Press WAKEUP to start");
+  LCD_Flush();
+  report("hud");
+
+  // blank two pages on the LCD and in RAM, DMA fill from one zero byte
+  LCD_ClearPages(2, 3);
+  report("clear_pg");
+
+  // clear in RAM only and draw the next screen, the frame diff sends the rest
+  LCD_ClearBuffer();
+  LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+  LCD_DrawText(3, LCD_TEXT_CENTER, "START");
+  LCD_Flush();
+  report("clear_buf");
+
+  // every step of the reference has to be run
+  for (n = 0; n < RefCount; n++)
+  {
+    if (!RefSteps[n].seen)
+    {
+      printf("%-10s missing, in the reference only\n", RefSteps[n].name);
+      Failures++;
+    }
+  }
+  if (RefOut != NULL)
+    fclose(RefOut);
+  if (RefCount > 0 || Failures > 0)
+    printf("\n%s: %u failure(s)\n", Failures ? "FAIL" : "PASS", Failures);
+  return Failures ? 1 : 0;
+}
@@ -0,0 +1,376 @@
+#include "st7565_emu.h"
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Controller state
+*******************************************************************************/
+static unsigned char ST7565_Ram[ST7565_PAGES][ST7565_COLUMNS];
+static unsigned char ST7565_Page;
+static unsigned char ST7565_Column;      // ST7565_COLUMNS: past the last column, writes are dropped
+static unsigned char ST7565_RmwColumn;   // column restored when RMW mode ends
+static unsigned char ST7565_Rmw;         // 1: reads do not advance the column
+static unsigned char ST7565_Latch;       // bus holder, returned by the next read
+static unsigned char ST7565_StartLine;
+static unsigned char ST7565_On;          // display on
+static unsigned char ST7565_Reverse;     // inverted display
+static unsigned char ST7565_AllOn;       // all points on
+static unsigned char ST7565_AdcReverse;  // segment n shows column 131 - n
+static unsigned char ST7565_ComReverse;  // common lines scanned bottom up
+static unsigned char ST7565_Argument;    // command waiting for its second byte
+static unsigned long ST7565_AccessCycles = 1;
+
+ST7565_StatsTypeDef ST7565_Stats;
+
+/*******************************************************************************
+* Function Name  : ST7565_Reset
+* Description    : hardware reset (/RES pin): power-on state, display off;
+                   the display data RAM keeps its content
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void ST7565_Reset(void)
+{
+  ST7565_Page = 0;
+  ST7565_Column = 0;
+  ST7565_Rmw = 0;
+  ST7565_Latch = 0;
+  ST7565_StartLine = 0;
+  ST7565_On = 0;
+  ST7565_Reverse = 0;
+  ST7565_AllOn = 0;
+  ST7565_AdcReverse = 0;
+  ST7565_ComReverse = 0;
+  ST7565_Argument = 0;
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_ResetStats
+* Description    : zero the bus transaction counters
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void ST7565_ResetStats(void)
+{
+  memset(&ST7565_Stats, 0, sizeof(ST7565_Stats));
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_SetAccessCycles
+* Description    : set the HCLK cycles one bus access takes, as programmed
+                   into the FSMC (see LCD_GetBusCycles())
+* Input          : cycles -- HCLK cycles per access
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void ST7565_SetAccessCycles(unsigned long cycles)
+{
+  ST7565_AccessCycles = cycles;
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_LoadLatch
+* Description    : fill the bus holder from the current address
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void ST7565_LoadLatch(void)
+{
+  if (ST7565_Page < ST7565_PAGES && ST7565_Column < ST7565_COLUMNS)
+    ST7565_Latch = ST7565_Ram[ST7565_Page][ST7565_Column];
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_WriteCommand
+* Description    : decode one command byte (A0=0)
+* Input          : cmd -- command byte
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void ST7565_WriteCommand(unsigned char cmd)
+{
+  ST7565_Stats.commands++;
+  ST7565_Stats.cycles += ST7565_AccessCycles;
+
+  // second byte of electronic volume, static indicator or booster ratio
+  if (ST7565_Argument)
+  {
+    ST7565_Argument = 0;
+    return;
+  }
+
+  if (cmd <= 0x0F)                        // column address, low nibble
+    ST7565_Column = (ST7565_Column & 0xF0) | cmd;
+  else if (cmd <= 0x1F)                   // column address, high nibble
+    ST7565_Column = ((cmd & 0x0F) << 4) | (ST7565_Column & 0x0F);
+  else if (cmd <= 0x3F)                   // resistor ratio, power control
+    return;
+  else if (cmd <= 0x7F)                   // display start line
+    ST7565_StartLine = cmd & 0x3F;
+  else if (cmd == 0x81 || cmd == 0xAC || cmd == 0xAD || cmd == 0xF8)
+    ST7565_Argument = 1;
+  else if (cmd == 0xA0 || cmd == 0xA1)
+    ST7565_AdcReverse = cmd & 1;
+  else if (cmd == 0xA4 || cmd == 0xA5)
+    ST7565_AllOn = cmd & 1;
+  else if (cmd == 0xA6 || cmd == 0xA7)
+    ST7565_Reverse = cmd & 1;
+  else if (cmd == 0xAE || cmd == 0xAF)
+    ST7565_On = cmd & 1;
+  else if (cmd >= 0xB0 && cmd <= 0xBF)    // page address, 9-15 select no page
+    ST7565_Page = cmd & 0x0F;
+  else if (cmd >= 0xC0 && cmd <= 0xCF)
+    ST7565_ComReverse = (cmd & 0x08) != 0;
+  else if (cmd == 0xE0)                   // read-modify-write
+  {
+    ST7565_Rmw = 1;
+    ST7565_RmwColumn = ST7565_Column;
+  }
+  else if (cmd == 0xEE && ST7565_Rmw)     // end, back to the first column
+  {
+    ST7565_Rmw = 0;
+    ST7565_Column = ST7565_RmwColumn;
+  }
+  else if (cmd == 0xE2)                   // internal reset, display settings stay
+  {
+    ST7565_StartLine = 0;
+    ST7565_Page = 0;
+    ST7565_Column = 0;
+    ST7565_ComReverse = 0;
+    ST7565_Rmw = 0;
+  }
+  // bias (0xA2/0xA3), NOP (0xE3) and test commands have no visible effect
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_WriteData
+* Description    : write one display data byte (A0=1) at the current address,
+                   the column advances up to the last one
+* Input          : data -- display data byte
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void ST7565_WriteData(unsigned char data)
+{
+  ST7565_Stats.dataWrites++;
+  ST7565_Stats.cycles += ST7565_AccessCycles;
+
+  if (ST7565_Page < ST7565_PAGES && ST7565_Column < ST7565_COLUMNS)
+  {
+    ST7565_Ram[ST7565_Page][ST7565_Column] = data;
+    ST7565_Column++;
+  }
+  ST7565_LoadLatch();
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_ReadData
+* Description    : read one display data byte (A0=1); the bus holder is
+                   returned and refilled, so the first read after setting
+                   the address is a dummy read. Outside RMW mode the column
+                   advances
+* Input          : None
+* Output         : None
+* Return         : the bus holder content
+*******************************************************************************/
+unsigned char ST7565_ReadData(void)
+{
+  unsigned char data = ST7565_Latch;
+
+  ST7565_Stats.dataReads++;
+  ST7565_Stats.cycles += ST7565_AccessCycles;
+
+  ST7565_LoadLatch();
+  if (!ST7565_Rmw && ST7565_Column < ST7565_COLUMNS)
+    ST7565_Column++;
+  return data;
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_GetPixel
+* Description    : what the panel shows at a point, with start line, segment
+                   and common direction and the display modes applied. The
+                   panel is mounted so that the driver's configuration (ADC
+                   normal, COM reverse) shows page 0 at the top
+* Input          : x -- segment from the left (0-127)
+                   y -- line from the top (0-63)
+* Output         : None
+* Return         : 1 -- dark, 0 -- clear
+*******************************************************************************/
+unsigned char ST7565_GetPixel(unsigned char x, unsigned char y)
+{
+  unsigned char column, line, pixel;
+
+  if (!ST7565_On || x >= ST7565_SEGMENTS || y >= ST7565_LINES)
+    return 0;
+  if (ST7565_AllOn)
+    return 1;
+
+  column = ST7565_AdcReverse ? ST7565_COLUMNS - 1 - x : x;
+  line = ST7565_ComReverse ? y : ST7565_LINES - 1 - y;
+  line = (line + ST7565_StartLine) % ST7565_LINES;
+
+  pixel = (ST7565_Ram[line / 8][column] >> (line % 8)) & 1;
+  return pixel ^ ST7565_Reverse;
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_SavePBM
+* Description    : write the panel output as a binary PBM (P4) image
+* Input          : path -- file name
+                   scale -- pixels per LCD dot (1 or more)
+* Output         : None
+* Return         : 0 -- success, -1 -- file error
+*******************************************************************************/
+int ST7565_SavePBM(const char *path, unsigned int scale)
+{
+  unsigned int width, height, x, y;
+  unsigned char byte;
+  FILE *f;
+
+  if (scale == 0)
+    scale = 1;
+  width = ST7565_SEGMENTS * scale;
+  height = ST7565_LINES * scale;
+
+  f = fopen(path, "wb");
+  if (f == NULL)
+    return -1;
+
+  fprintf(f, "P4\n%u %u\n", width, height);
+  for (y = 0; y < height; y++)
+  {
+    // the width is a multiple of 8, rows need no padding
+    for (x = 0, byte = 0; x < width; x++)
+    {
+      byte = (byte << 1) | ST7565_GetPixel(x / scale, y / scale);
+      if (x % 8 == 7)
+        fputc(byte, f);
+    }
+  }
+
+  return fclose(f) == 0 ? 0 : -1;
+}
+
+/*******************************************************************************
+* PNG output
+* A 1-bit greyscale image with the zlib stream made of stored (uncompressed)
+* deflate blocks, so no compression library is needed.
+*******************************************************************************/
+static unsigned long ST7565_Crc(unsigned long crc, const unsigned char *data, unsigned long len)
+{
+  unsigned char bit;
+
+  crc = ~crc & 0xFFFFFFFFUL;
+  while (len--)
+  {
+    crc ^= *data++;
+    for (bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+  }
+  return ~crc & 0xFFFFFFFFUL;
+}
+
+static void ST7565_Put32(unsigned char *p, unsigned long v)
+{
+  p[0] = (unsigned char)(v >> 24);
+  p[1] = (unsigned char)(v >> 16);
+  p[2] = (unsigned char)(v >> 8);
+  p[3] = (unsigned char)v;
+}
+
+static void ST7565_PutChunk(FILE *f, const char *type, const unsigned char *data, unsigned long len)
+{
+  unsigned char head[8], tail[4];
+  unsigned long crc;
+
+  ST7565_Put32(head, len);
+  memcpy(head + 4, type, 4);
+  crc = ST7565_Crc(0, head + 4, 4);
+  crc = ST7565_Crc(crc, data, len);
+  ST7565_Put32(tail, crc);
+
+  fwrite(head, 1, 8, f);
+  fwrite(data, 1, len, f);
+  fwrite(tail, 1, 4, f);
+}
+
+/*******************************************************************************
+* Function Name  : ST7565_SavePNG
+* Description    : write the panel output as a PNG image, dark dots black
+* Input          : path -- file name
+                   scale -- pixels per LCD dot (1-16)
+* Output         : None
+* Return         : 0 -- success, -1 -- file or scale error
+*******************************************************************************/
+int ST7565_SavePNG(const char *path, unsigned int scale)
+{
+  static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  // largest image: 16 * 128 / 8 + 1 filter byte per row, 16 * 64 rows
+  static unsigned char raw[(16 * ST7565_SEGMENTS / 8 + 1) * 16 * ST7565_LINES];
+  static unsigned char idat[sizeof(raw) + sizeof(raw) / 65535 * 5 + 5 + 6];
+  unsigned char ihdr[13];
+  unsigned long stride, rawLen, pos, block, a = 1, b = 0, n;
+  unsigned int width, height, x, y;
+  FILE *f;
+
+  if (scale == 0)
+    scale = 1;
+  if (scale > 16)
+    return -1;
+  width = ST7565_SEGMENTS * scale;
+  height = ST7565_LINES * scale;
+  stride = width / 8 + 1;
+  rawLen = stride * height;
+
+  // scanlines: filter type 0, then 8 pixels per byte, 1 = white
+  memset(raw, 0, rawLen);
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++)
+      if (!ST7565_GetPixel(x / scale, y / scale))
+        raw[y * stride + 1 + x / 8] |= 0x80 >> (x % 8);
+
+  // zlib header, stored blocks, Adler-32
+  n = 0;
+  idat[n++] = 0x78;
+  idat[n++] = 0x01;
+  for (pos = 0; pos < rawLen; pos += block)
+  {
+    block = rawLen - pos > 65535 ? 65535 : rawLen - pos;
+    idat[n++] = pos + block == rawLen;  // BFINAL, BTYPE = stored
+    idat[n++] = (unsigned char)block;
+    idat[n++] = (unsigned char)(block >> 8);
+    idat[n++] = (unsigned char)~block;
+    idat[n++] = (unsigned char)(~block >> 8);
+    memcpy(&idat[n], &raw[pos], block);
+    n += block;
+  }
+  for (pos = 0; pos < rawLen; pos++)
+  {
+    a = (a + raw[pos]) % 65521;
+    b = (b + a) % 65521;
+  }
+  ST7565_Put32(&idat[n], (b << 16) | a);
+  n += 4;
+
+  ST7565_Put32(ihdr, width);
+  ST7565_Put32(ihdr + 4, height);
+  ihdr[8] = 1;    // bit depth
+  ihdr[9] = 0;    // greyscale
+  ihdr[10] = 0;   // deflate
+  ihdr[11] = 0;   // adaptive filtering
+  ihdr[12] = 0;   // no interlace
+
+  f = fopen(path, "wb");
+  if (f == NULL)
+    return -1;
+  fwrite(signature, 1, sizeof(signature), f);
+  ST7565_PutChunk(f, "IHDR", ihdr, sizeof(ihdr));
+  ST7565_PutChunk(f, "IDAT", idat, n);
+  ST7565_PutChunk(f, "IEND", NULL, 0);
+
+  return fclose(f) == 0 ? 0 : -1;
+}
@@ -0,0 +1,41 @@
+#ifndef __ST7565_EMU_H
+#define __ST7565_EMU_H
+
+/*******************************************************************************
+* ST7565 emulator for host builds (LCD_HOST)
+* Models the controller as seen through the 8080 bus: display data RAM of
+* 9 pages x 132 columns, the page/column address with auto-increment, the
+* dummy read latch, read-modify-write mode and the display control commands.
+* lcd.c talks to it through its bus helpers instead of the FSMC window.
+*******************************************************************************/
+
+#define ST7565_PAGES      9     // 8 pages of 8 lines + the icon line
+#define ST7565_COLUMNS    132
+#define ST7565_LINES      64    // common lines driven by the panel
+#define ST7565_SEGMENTS   128   // segment lines wired to the panel
+
+/*bus transactions and time spent on the bus, see ST7565_ResetStats()*/
+typedef struct
+{
+  unsigned long commands;     // command bytes written (A0=0)
+  unsigned long dataWrites;   // display data bytes written (A0=1)
+  unsigned long dataReads;    // display data bytes read, dummy reads included
+  unsigned long long cycles;  // HCLK cycles, see ST7565_SetAccessCycles()
+} ST7565_StatsTypeDef;
+
+extern ST7565_StatsTypeDef ST7565_Stats;
+
+void ST7565_Reset(void);
+void ST7565_ResetStats(void);
+void ST7565_SetAccessCycles(unsigned long cycles);
+
+void ST7565_WriteCommand(unsigned char cmd);
+void ST7565_WriteData(unsigned char data);
+unsigned char ST7565_ReadData(void);
+
+// Panel output: x = segment from the left (0-127), y = line from the top (0-63)
+unsigned char ST7565_GetPixel(unsigned char x, unsigned char y);
+int ST7565_SavePBM(const char *path, unsigned int scale);
+int ST7565_SavePNG(const char *path, unsigned int scale);
+
+#endif /* __ST7565_EMU_H */
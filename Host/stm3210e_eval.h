@@ -0,0 +1,19 @@
+#ifndef __STM3210E_EVAL_H
+#define __STM3210E_EVAL_H
+
+/*******************************************************************************
+* Host build BSP shim: the board LEDs used by function.c (PF6-PF9)
+*******************************************************************************/
+
+#include "stm32f1xx_hal.h"
+
+#define LED1_PIN        GPIO_PIN_6
+#define LED1_GPIO_PORT  GPIOF
+#define LED2_PIN        GPIO_PIN_7
+#define LED2_GPIO_PORT  GPIOF
+#define LED3_PIN        GPIO_PIN_8
+#define LED3_GPIO_PORT  GPIOF
+#define LED4_PIN        GPIO_PIN_9
+#define LED4_GPIO_PORT  GPIOF
+
+#endif /* __STM3210E_EVAL_H */
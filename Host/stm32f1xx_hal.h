@@ -0,0 +1,138 @@
+#ifndef __STM32F1xx_HAL_H
+#define __STM32F1xx_HAL_H
+
+/*******************************************************************************
+* Host build HAL shim
+* Just enough of the STM32F1 HAL for lcd.c and function.c to compile on a PC:
+* the types and constants they use, and no-op peripheral functions in
+* hal_host.c. The LCD bus itself is the ST7565 emulator (LCD_HOST in lcd.h).
+*******************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define HSI_VALUE       8000000UL    // as Inc/stm32f1xx_hal_conf.h
+#define HOST_HCLK_FREQ  HSI_VALUE    // HCLK reported to the driver: SystemClock_Config() runs from HSI, AHB /1
+
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+
+/* GPIO ----------------------------------------------------------------------*/
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+typedef struct { uint32_t CRL, CRH; } GPIO_TypeDef;
+typedef struct { uint32_t Pin, Mode, Pull, Speed; } GPIO_InitTypeDef;
+
+extern GPIO_TypeDef *GPIOA, *GPIOB, *GPIOC, *GPIOD, *GPIOE, *GPIOF, *GPIOG;
+
+#define GPIO_PIN_0        0x0001U
+#define GPIO_PIN_1        0x0002U
+#define GPIO_PIN_4        0x0010U
+#define GPIO_PIN_5        0x0020U
+#define GPIO_PIN_6        0x0040U
+#define GPIO_PIN_7        0x0080U
+#define GPIO_PIN_8        0x0100U
+#define GPIO_PIN_9        0x0200U
+#define GPIO_PIN_10       0x0400U
+#define GPIO_PIN_11       0x0800U
+#define GPIO_PIN_12       0x1000U
+#define GPIO_PIN_13       0x2000U
+#define GPIO_PIN_14       0x4000U
+#define GPIO_PIN_15       0x8000U
+#define GPIO_MODE_AF_PP   0x02U
+#define GPIO_SPEED_HIGH   0x03U
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+
+/* Clocks --------------------------------------------------------------------*/
+#define __HAL_RCC_GPIOA_CLK_ENABLE()        do { } while (0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE()        do { } while (0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE()        do { } while (0)
+#define __HAL_RCC_GPIOD_CLK_ENABLE()        do { } while (0)
+#define __HAL_RCC_GPIOE_CLK_ENABLE()        do { } while (0)
+#define __HAL_RCC_GPIOF_CLK_ENABLE()        do { } while (0)
+#define __HAL_RCC_GPIOG_CLK_ENABLE()        do { } while (0)
+#define __HAL_RCC_DMA1_CLK_ENABLE()         do { } while (0)
+#define __FSMC_CLK_ENABLE()                 do { } while (0)
+#define __FSMC_CLK_DISABLE()                do { } while (0)
+#define __HAL_AFIO_FSMCNADV_DISCONNECTED()  do { } while (0)
+
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+extern unsigned long Host_DelayCalls;   // HAL_Delay() calls, blocking waits on target
+
+/* FSMC ----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t AddressSetupTime, AddressHoldTime, DataSetupTime, BusTurnAroundDuration;
+  uint32_t CLKDivision, DataLatency, AccessMode;
+} FSMC_NORSRAM_TimingTypeDef;
+
+typedef struct
+{
+  uint32_t NSBank, DataAddressMux, MemoryType, MemoryDataWidth, BurstAccessMode;
+  uint32_t WaitSignalPolarity, WrapMode, WaitSignalActive, WriteOperation;
+  uint32_t WaitSignal, ExtendedMode, WriteBurst, AsynchronousWait;
+} FSMC_NORSRAM_InitTypeDef;
+
+typedef struct
+{
+  void *Instance;
+  void *Extended;
+  FSMC_NORSRAM_InitTypeDef Init;
+} SRAM_HandleTypeDef;
+
+#define FSMC_NORSRAM_DEVICE             NULL
+#define FSMC_NORSRAM_EXTENDED_DEVICE    NULL
+#define FSMC_NORSRAM_BANK4              0x06U
+#define FSMC_DATA_ADDRESS_MUX_DISABLE   0U
+#define FSMC_MEMORY_TYPE_SRAM           0U
+#define FSMC_NORSRAM_MEM_BUS_WIDTH_8    0U
+#define FSMC_BURST_ACCESS_MODE_DISABLE  0U
+#define FSMC_WAIT_SIGNAL_POLARITY_LOW   0U
+#define FSMC_WRAP_MODE_DISABLE          0U
+#define FSMC_WAIT_TIMING_BEFORE_WS      0U
+#define FSMC_WRITE_OPERATION_ENABLE     0x1000U
+#define FSMC_WAIT_SIGNAL_DISABLE        0U
+#define FSMC_EXTENDED_MODE_DISABLE      0U
+#define FSMC_WRITE_BURST_DISABLE        0U
+#define FSMC_ASYNCHRONOUS_WAIT_DISABLE  0U
+#define FSMC_ACCESS_MODE_A              0U
+
+HAL_StatusTypeDef HAL_SRAM_Init(SRAM_HandleTypeDef *hsram, FSMC_NORSRAM_TimingTypeDef *Timing,
+                                FSMC_NORSRAM_TimingTypeDef *ExtTiming);
+
+/* DMA and NVIC --------------------------------------------------------------*/
+typedef struct { uint32_t CCR, CNDTR, CPAR, CMAR; } DMA_Channel_TypeDef;
+
+typedef struct
+{
+  uint32_t Direction, PeriphInc, MemInc, PeriphDataAlignment, MemDataAlignment, Mode, Priority;
+} DMA_InitTypeDef;
+
+typedef struct __DMA_HandleTypeDef
+{
+  DMA_Channel_TypeDef *Instance;
+  DMA_InitTypeDef Init;
+  void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+} DMA_HandleTypeDef;
+
+extern DMA_Channel_TypeDef *DMA1_Channel6;
+
+#define DMA_MEMORY_TO_MEMORY  0x4000U
+#define DMA_PINC_ENABLE       0x0040U
+#define DMA_MINC_DISABLE      0U
+#define DMA_PDATAALIGN_BYTE   0U
+#define DMA_MDATAALIGN_BYTE   0U
+#define DMA_NORMAL            0U
+#define DMA_PRIORITY_HIGH     0x2000U
+
+typedef enum { DMA1_Channel6_IRQn = 16 } IRQn_Type;
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+
+#endif /* __STM32F1xx_HAL_H */
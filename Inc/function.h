@@ -1,128 +1,169 @@
-/**
- ******************************************************************************
- * @file    function.h
- * @brief   Chrome Dino Game - Header file with sprite definitions and API
- ******************************************************************************
- * 
- * SPRITE DRAWING NOTES:
- * --------------------
- * - All sprites are 8x16 format (each sprite index represents 8x16 pixels)
- * - 16x16 sprites use TWO consecutive indices (e.g., 125-126)
- * - Use LCD_DrawChar(page, column, sprite_index) to draw individual sprites
- * - Page: vertical position (0-7), Column: horizontal position (0-127)
- * - Each sprite is 8 pixels wide, so spacing is typically multiples of 8
- * 
- * QUICK START:
- * -----------
- * 1. Create a DinoGameState: DinoGameState game;
- * 2. Initialize it: initGameState(&game);
- * 3. In game loop:
- *    - Clear old position: clearSprite(game.dinoX, game.dinoY, 2);
- *    - Update game logic: handleJump(&game); updateDinoAnimation(&game);
- *    - Draw new position: drawDino(&game);
- * 
- ******************************************************************************
- */
-
-#ifndef __FUNCTION_H
-#define __FUNCTION_H
-
-#include "main.h"
-#include "lcd.h"
-
-// Game sprite indices in ChineseTable (8x16 format)
-// 16x16 sprites use 32 bytes (first 16 = left half, next 16 = right half)
-#define SPRITE_CACTUS_BIG    120  // Big cactus (16x16) - indices 120-121
-#define SPRITE_CACTUS_SMALL  122  // Small cactus (8x16)
-#define SPRITE_STAR          123  // Star decoration (16x16) - indices 123-124
-#define SPRITE_CLOUD         149  // Cloud decoration (16x16) - indices 149-150
-#define SPRITE_DINO_STAND    125  // Dino standing/jumping (16x16) - indices 125-126
-#define SPRITE_DINO_RUN      127  // Dino running frame 1 (16x16) - indices 127-128
-#define SPRITE_DINO_RUN_2    129  // Dino running frame 2 (16x16) - indices 129-130
-#define SPRITE_DINO_DEAD     131  // Dino dead sprite (16x16) - indices 131-132
-#define SPRITE_MOON          133  // Moon decoration (16x16) - indices 133-134
-#define SPRITE_BIRD_FLY_1    135  // Flying bird frame 1 (16x16) - indices 135-136
-#define SPRITE_BIRD_FLY_2    137  // Flying bird frame 2 (16x16) - indices 137-138
-#define SPRITE_DINO_HIT      139  // Dino hit sprite (16x16) - indices 139-140
-#define SPRITE_DINO_CROUCH   141  // Dino crouch frame 1 (16x16) - indices 141-142
-#define SPRITE_DINO_CROUCH_2 143  // Dino crouch frame 2 (16x16) - indices 143-144
-#define SPRITE_GROUND_LINE   145  // Ground line 1 - plain (8x16)
-#define SPRITE_GROUND_LINE_2 146  // Ground line 2 - with pebbles (8x16)
-#define SPRITE_GROUND_LINE_3 147  // Ground line 3 - small bump (8x16)
-#define SPRITE_GROUND_LINE_4 148  // Ground line 4 - with rocks (8x16)
-
-// Ground pattern length (number of tiles in repeating pattern)
-#define GROUND_PATTERN_LENGTH 16
-
-// Bird flight heights (page number - lower = higher on screen)
-#define BIRD_FLIGHT_PAGE     3    // High bird flies at page 3, must NOT jump to avoid
-#define BIRD_LOW_FLIGHT_PAGE 5    // Low bird flies at page 5, must CROUCH to avoid
-
-// Game constants
-#define GROUND_PAGE          7    // The page/row where ground is drawn (bottom of LCD)
-#define GROUND_OFFSET        1    // Offset from ground page where DINO and Obstacles are drawn
-#define JUMP_MAX_HEIGHT      3    // Maximum jump height in pages
-#define JUMP_INITIAL_VELOCITY 6   // Initial upward velocity (higher = faster start)
-#define JUMP_GRAVITY         1    // How much velocity decreases each move (gravity effect)
-#define OBSTACLE_SPEED_INIT  6    // Initial frames between obstacle movements (higher = slower)
-#define OBSTACLE_SPEED_MIN   3    // Minimum obstacle speed (fastest)
-#define SPEED_INCREASE_RATE  160  // Frames between speed increases
-
-// PWM Timer period constant (fixed fast frame rate)
-#define TIMER_PERIOD_FIXED   40   // Fixed timer period (~4ms per frame, ~250 FPS)
-
-// Obstacle spawn interval constants (frames between spawns)
-#define OBSTACLE_SPAWN_MIN   30   // Minimum frames between obstacle spawns
-#define OBSTACLE_SPAWN_MAX   100  // Maximum frames between obstacle spawns
-
-// Game state structure
-typedef struct {
-    unsigned char dinoX;          // Dino X position (page)
-    unsigned char dinoY;          // Dino Y position (column)
-    unsigned char animFrame;      // Animation frame counter
-    unsigned char jumpHeight;     // Current jump height (pages above ground)
-    unsigned char isJumping;      // Jump state flag (going up)
-    unsigned char isCrouching;    // Crouch state flag
-    signed char jumpVelocity;     // Current jump velocity (positive=up, negative=down)
-    unsigned char jumpFrameCounter; // Frame counter for smooth movement timing
-    unsigned char lives;          // Number of lives (1-4)
-    unsigned int score;           // Current game score
-    unsigned char currentSpeed;   // Current obstacle speed (frames between moves)
-    unsigned int speedTimer;      // Timer for speed increases
-    unsigned char groundOffset;   // Ground pattern scroll offset (0-15)
-} DinoGameState;
-
-// Obstacle structure
-typedef struct {
-    unsigned char x;              // X position (page)
-    unsigned char y;              // Y position (column)
-    unsigned char type;           // 0=cactus big, 1=cactus small, 2=bird high, 3=bird low
-    unsigned char active;         // Is obstacle active
-    unsigned char animFrame;      // Animation frame for bird
-} Obstacle;
-
-// Game functions
-void drawDino(DinoGameState *state);
-void drawDinoDead(DinoGameState *state);  // Draw dead dino sprite
-void drawDinoHit(DinoGameState *state);   // Draw dino hit sprite (when losing a life)
-void updateDinoAnimation(DinoGameState *state);
-void drawCactus(unsigned char x, unsigned char y, unsigned char type);
-void drawBird(unsigned char x, unsigned char y, unsigned char animFrame);  // Draw animated bird
-void drawStar(unsigned char x, unsigned char y);
-void drawCloud(unsigned char x, unsigned char y);
-void drawMoon(unsigned char x, unsigned char y);
-void drawGroundLine(unsigned char y);
-void drawGroundLineAvoidSprites(unsigned char page, DinoGameState *dino, Obstacle *obstacles, unsigned char numObstacles);
-void updateGroundScroll(DinoGameState *state);
-void animateGroundLineEntry(unsigned char page, DinoGameState *dino);
-void clearSprite(unsigned char x, unsigned char y, unsigned char width);
-void initGameState(DinoGameState *state);
-void handleJump(DinoGameState *state);
-void drawScore(unsigned int score, unsigned char x, unsigned char y);
-void drawGameScore(unsigned int score);  // Draw score in upper right corner
-void drawStartScreen(void);
-void drawEndScreen(void);
-void updateLivesLED(unsigned char lives);
-void updateGameSpeed(DinoGameState *state);  // PWM-based speed control
-
+/**
+ ******************************************************************************
+ * @file    function.h
+ * @brief   Chrome Dino Game - Header file with sprite definitions and API
+ ******************************************************************************
+ * 
+ * SPRITE DRAWING NOTES:
+ * --------------------
+ * - Sprites are drawn as ASCII art in Tools/assets/sprites.txt and compiled
+ *   by Tools/spritec.py into Inc/sprites.h and Src/sprites.c: one ID per
+ *   sprite (SPRITE_DINO_RUN, ...), animation frames and 8x16 glyphs shared
+ *   between sprites are stored once
+ * - Use LCD_BlitSprite(column, row, id, frame, mode) to draw a sprite at any
+ *   pixel position, LCD_DrawChar(page, column, glyph) for one font glyph
+ * - Page: vertical position (0-7), Column: horizontal position (0-127)
+ * - Moving sprites are drawn on the playfield layer; ground, decorations and
+ *   text are on the background layer, so sprites pass over them without
+ *   erasing them
+ * 
+ * QUICK START:
+ * -----------
+ * 1. Create a DinoGameState: DinoGameState game;
+ * 2. Initialize it: initGameState(&game);
+ * 3. In game loop:
+ *    - Clear old position: clearSpriteAt(game.dinoRow, game.dinoY, 2);
+ *    - Update game logic: handleJump(&game); updateDinoAnimation(&game);
+ *    - Draw new position: drawDino(&game);
+ * 
+ ******************************************************************************
+ */
+
+#ifndef __FUNCTION_H
+#define __FUNCTION_H
+
+#include "main.h"
+#include "lcd.h"
+
+// Game sprites are compiled from Tools/assets/sprites.txt into sprites.h:
+// SPRITE_DINO_RUN, SPRITE_BIRD_FLY, ... are IDs drawn with LCD_BlitSprite()
+
+// Frames of SPRITE_GROUND_LINE (8x16 tiles)
+#define GROUND_PLAIN         0    // Plain line
+#define GROUND_PEBBLES       1    // Line with pebbles
+#define GROUND_BUMP          2    // Small bump
+#define GROUND_ROCKS         3    // Line with rocks
+
+// Ground pattern length (number of tiles in repeating pattern)
+#define GROUND_PATTERN_LENGTH 16
+
+// Bird flight heights (page number - lower = higher on screen)
+#define BIRD_FLIGHT_PAGE     3    // High bird flies at page 3, must NOT jump to avoid
+#define BIRD_LOW_FLIGHT_PAGE 5    // Low bird flies at page 5, must CROUCH to avoid
+
+// Game constants
+#define GROUND_PAGE          7    // The page/row where ground is drawn (bottom of LCD)
+#define GROUND_OFFSET        1    // Offset from ground page where DINO and Obstacles are drawn
+#define JUMP_MAX_HEIGHT      3    // Maximum jump height in pages
+#define JUMP_FIXED_SHIFT     4    // Jump physics use 1/16 pixel fixed point
+#define JUMP_INITIAL_VELOCITY 80  // Initial upward velocity (1/16 pixel per frame)
+#define JUMP_GRAVITY         5    // Velocity lost every frame (1/16 pixel per frame)
+#define DINO_GROUND_ROW      ((GROUND_PAGE - GROUND_OFFSET) * 8)  // Top pixel row of the dino on the ground
+#define SCROLL_FIXED_SHIFT   4    // Scroll positions and speeds use 1/16 pixel fixed point
+#define SCROLL_SPEED_INIT    21   // Initial scroll speed (1/16 pixel per frame, ~1.3 px)
+#define SCROLL_SPEED_MAX     64   // Maximum scroll speed (1/16 pixel per frame, 4 px)
+#define SCROLL_SPEED_STEP    2    // Speed gained at every speed increase
+#define SKY_PARALLAX_SHIFT   2    // Decorations scroll at 1/4 of the ground speed
+#define SKY_WIDTH            (128 + 16)  // Decorations wrap around past both edges
+#define SPEED_INCREASE_RATE  160  // Frames between speed increases
+
+// Frame timer: TIM1 runs from HCLK, which SystemClock_Config() takes from the
+// 8 MHz HSI without PLL (AHB and APB2 /1); one update every
+// (TIMER_PERIOD_FIXED + 1) * (TIMER_PRESCALER + 1) clocks, ~36.9 ms (~27 FPS)
+#define TIMER_CLOCK_HZ       HSI_VALUE
+#define TIMER_PRESCALER      7200
+#define TIMER_PERIOD_FIXED   40   // Fixed timer period, see FRAME_US
+#define FRAME_US             ((TIMER_PERIOD_FIXED + 1UL) * (TIMER_PRESCALER + 1UL) * 1000UL / (TIMER_CLOCK_HZ / 1000UL))
+#define MS_TO_FRAMES(ms)     (((ms) * 1000UL + FRAME_US / 2) / FRAME_US)  // rounded to whole frames
+
+// Hit and game over effects, in frames of the frame timer
+// They run on counters in DinoGameState, the frame loop never stops for them
+#define HIT_INVULNERABLE_FRAMES MS_TO_FRAMES(600)  // No collisions for 600 ms after a hit
+#define HIT_SPRITE_FRAMES    MS_TO_FRAMES(300)  // Hit sprite shown for the first 300 ms of them
+#define HIT_BLINK_FRAMES     MS_TO_FRAMES(150)  // Then the dino blinks, visible half of every period
+#define HIT_FLASH_FRAMES     MS_TO_FRAMES(100)  // Screen inverted (Display_Reverse) for 100 ms
+#define GAME_OVER_LOCK_FRAMES MS_TO_FRAMES(500) // Restart ignored for 500 ms after game over
+
+// HUD on page 0 in the small font (Tools/assets/hud_font.txt); the dino's
+// jump peaks below it and the sky decorations start on the next page
+// Every field is redrawn on its own, text is right-aligned; the scores are
+// zero padded and only their changed digits are redrawn
+#define HUD_PAGE             0
+#define HUD_LIVES_COL        0    // "LIFE 4"
+#define HUD_LIVES_WIDTH      22
+#define HUD_SPEED_COL        26   // "SPD 22"
+#define HUD_SPEED_WIDTH      24
+#define HUD_HISCORE_COL      64   // "HI 000000", "HI" is a tile: a multiple of 8
+#define HUD_HISCORE_LABEL    8    // columns of "HI" and the gap before the digits
+#define HUD_SCORE_COL        105  // "000000", ends at the right edge
+#define HUD_SCORE_DIGITS     6
+#define HUD_SCORE_MAX        999999UL  // HUD_SCORE_DIGITS nines, larger scores show this
+#define HUD_DIGIT_PITCH      4    // HUD font digits: 3 columns and a gap
+
+// Obstacle spawn interval constants (frames between spawns)
+#define OBSTACLE_SPAWN_MIN   30   // Minimum frames between obstacle spawns
+#define OBSTACLE_SPAWN_MAX   100  // Maximum frames between obstacle spawns
+
+// Game state structure
+typedef struct {
+    unsigned char dinoY;          // Dino Y position (column)
+    unsigned char dinoRow;        // Dino top pixel row, follows the jump arc
+    unsigned char animFrame;      // Animation frame counter
+    unsigned char jumpHeight;     // Current jump height (pixels above ground)
+    unsigned char isJumping;      // Jump state flag (going up)
+    unsigned char isCrouching;    // Crouch state flag
+    signed char jumpVelocity;     // Current jump velocity (1/16 pixel per frame, positive=up)
+    int jumpPos;                  // Jump height in 1/16 pixels
+    unsigned char lives;          // Number of lives (1-4)
+    uint32_t score;               // Current game score
+    unsigned char scrollSpeed;    // Current scroll speed (1/16 pixel per frame)
+    unsigned int speedTimer;      // Timer for speed increases
+    unsigned int scrollPos;       // Distance scrolled (1/16 pixels), drives ground and sky
+    unsigned char hitTimer;       // Frames of invulnerability left after a hit, 0 = none
+    unsigned char flashTimer;     // Frames of inverted screen left after a hit
+} DinoGameState;
+
+// Obstacle structure
+typedef struct {
+    unsigned char x;              // X position (page)
+    int y;                        // Y position (column of left edge, negative while leaving)
+    unsigned char type;           // 0=cactus big, 1=cactus small, 2=bird high, 3=bird low
+    unsigned char active;         // Is obstacle active
+    unsigned char animFrame;      // Pixels travelled, drives the bird animation
+} Obstacle;
+
+// Game functions
+void drawDino(DinoGameState *state);
+void drawDinoDead(DinoGameState *state);  // Draw dead dino sprite
+void drawDinoHit(DinoGameState *state);   // Draw dino hit sprite (when losing a life)
+void updateDinoAnimation(DinoGameState *state);
+void drawCactus(unsigned char x, int y, unsigned char type);
+void drawBird(unsigned char x, int y, unsigned char animFrame);  // Draw animated bird
+unsigned char checkCollision(const DinoGameState *state, const Obstacle *obstacle);  // Sprite hitboxes overlap
+void drawStar(unsigned char x, int y);
+void drawCloud(unsigned char x, int y);
+void drawMoon(unsigned char x, int y);
+void drawSky(DinoGameState *state);   // Draw parallax-scrolled decorations
+void moveSky(DinoGameState *state, unsigned int prevScrollPos);  // Redraw decorations if they moved
+void drawGroundLine(unsigned char y);
+void drawScrollingGround(unsigned char page, DinoGameState *dino);
+unsigned char updateScroll(DinoGameState *state);  // Returns whole pixels scrolled this frame
+void animateGroundLineEntry(unsigned char page, DinoGameState *dino);
+void clearSprite(unsigned char x, unsigned char y, unsigned char width);
+void clearSpriteAt(unsigned char row, int col, unsigned char width);
+void initGameState(DinoGameState *state);
+void handleJump(DinoGameState *state);
+void drawScore(uint32_t score, unsigned char x, unsigned char y);
+void drawGameScore(uint32_t score);  // Draw score in upper right corner
+void drawHighScore(uint32_t hiScore);
+void drawSpeedLevel(DinoGameState *state);
+void drawLives(unsigned char lives);
+void drawHud(DinoGameState *state, uint32_t hiScore);  // Draw all HUD fields
+void drawStartScreen(void);
+void drawEndScreen(void);
+void updateLivesLED(unsigned char lives);
+void updateGameSpeed(DinoGameState *state);  // Gradual scroll speed increase
+void startHitEffect(DinoGameState *state);   // Flash, hit sprite, blink and i-frames
+void updateHitEffect(DinoGameState *state);  // Count the effect down, once per frame
+
 #endif /* __FUNCTION_H */
\ No newline at end of file
@@ -1,150 +1,228 @@
-#ifndef __LCD_H
-#define __LCD_H
-
-#include "stm32f1xx_hal.h"
-
-#define Reset_LCD         0xe2
-
-#define Set_Start_Line_X  0x40
-#define Set_Page_Addr_X   0xb0
-#define Set_ColH_Addr_X   0x10
-#define Set_ColL_Addr_X   0x0
-
-#define LCD_Reset   0xe2
-#define Display_Off   0xae
-#define Display_On    0xaf
-#define Set_ADC_Normal    0xa0
-#define Set_ADC_Reverse   0xa1
-#define Set_LCD_Bias_7    0xa3
-#define Set_LCD_Bias_9    0xa2
-#define RMW_Mode_En       0xe0
-#define RMW_Mode_Dis      0xee
-#define COM_Scan_Dir_Normal 0xc0
-#define COM_Scan_Dir_Reverse  0xc8
-
-#define Set_Resistor_Ratio_X   0x20
-#define Set_Ref_Vol_Mode       0x81
-#define Set_Ref_Vol_Reg        0x20
-
-#define Display_Normal    0xa6
-#define Display_Reverse   0xa7
-#define Display_All_On    0xa5
-#define Display_All_Normal  0xa4
-// ZYMG12864
-/*A0=0  -- cmd*/
-#define LCD_Command  *((volatile unsigned char * )0x6c000000)
-/*A0=1 -- data*/
-#define LCD_Data  *((volatile unsigned char * )0x6c000001)
-
-/*define the constant for display digital char*/
-#define	D0		0
-#define	D1		1
-#define	D2		2
-#define	D3		3
-#define	D4		4
-#define	D5		5
-#define	D6		6
-#define	D7		7
-#define	D8		8
-#define	D9		9
-#define	DPoint	10	//"."
-#define DDash	20	//"-"
-#define DColon	21	//":"
-
-#define Da	30
-#define Db	31
-#define Dc	32
-#define Dd	33
-
-#define De	34
-#define Df	35
-#define Dg	36
-#define Dh	37
-#define Di	38
-#define Dj	39
-#define Dk	40
-#define Dl	41
-#define Dm	42
-#define Dn	43
-#define Do	44
-#define Dp	45
-#define Dq	46
-#define Dr	47
-#define Ds	48
-#define Dt	49
-#define Du	50
-
-#define Dv	51
-#define Dw	52
-#define Dx	53
-#define Dy	54
-#define Dz	55
-
-#define DA	56
-#define DB	57
-#define DC	58
-#define DD	59
-#define DE	60
-#define DF	61
-#define DG	62
-#define DH	63
-#define DI	64
-#define DJ	65
-#define DK	66
-#define DL	67
-#define DM	68
-#define DN	69
-#define DO	70
-#define DP	71
-#define DQ	72
-#define DR	73
-#define DS	74
-#define DT	75
-#define DU	76
-#define DV	77
-#define DW	78
-#define DX	79
-#define DY	80
-#define DZ	81
-
-extern unsigned char DispSTLoGoTable[];
-extern unsigned char ChineseTable[][16];
-
-unsigned char LCD_DrawString(unsigned char Xpos, unsigned char Ypos, unsigned char *c, unsigned char length);
-void LCD_Init(void);
-void STM3210E_LCD_Init(void);
-void Converse_Logo(void);
-void LCD_Clear(void);
-
-void LCD_DrawChar(unsigned char Xpos, unsigned char Ypos, unsigned char offset);
-
-void LCD_PowerOn(void);
-void LCD_DisplayOn(void);
-void LCD_DisplayOff(void);
-
-void LCD_CtrlLinesConfig(void);
-void LCD_FSMCConfig(void);
-
-void delay(void);
-void reset_delay(void);
-void power_delay(void);
-
-void LCD_Draw_ST_Logo(void);
-void LCD_Reset_Cursor(void);
-void LCD_Clr_Cursor(signed char x);
-void LCD_Set_Cursor(signed char x);
-
-// Pixel control functions
-unsigned char LCD_SetPixel(unsigned char x, unsigned char y, unsigned char state);
-unsigned char LCD_DrawLine(unsigned char x1, unsigned char x2, unsigned char y, unsigned char state);
-unsigned char LCD_DrawVLine(unsigned char x, unsigned char y1, unsigned char y2, unsigned char state);
-unsigned char LCD_DrawLineAngle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char state);
-unsigned char LCD_DrawRect(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
-unsigned char LCD_FillRect(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
-unsigned char LCD_DrawCircle(unsigned char xc, unsigned char yc, unsigned char radius, unsigned char state);
-unsigned char LCD_FillCircle(unsigned char xc, unsigned char yc, unsigned char radius, unsigned char state);
-unsigned char LCD_DrawTriangle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
-unsigned char LCD_FillTriangle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
-unsigned char LCD_SetArea(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
-
-#endif /* __LCD_H */
+#ifndef __LCD_H
+#define __LCD_H
+
+#include "stm32f1xx_hal.h"
+
+#define Reset_LCD         0xe2
+
+#define Set_Start_Line_X  0x40
+#define Set_Page_Addr_X   0xb0
+#define Set_ColH_Addr_X   0x10
+#define Set_ColL_Addr_X   0x0
+
+#define LCD_Reset   0xe2
+#define Display_Off   0xae
+#define Display_On    0xaf
+#define Set_ADC_Normal    0xa0
+#define Set_ADC_Reverse   0xa1
+#define Set_LCD_Bias_7    0xa3
+#define Set_LCD_Bias_9    0xa2
+#define RMW_Mode_En       0xe0
+#define RMW_Mode_Dis      0xee
+#define COM_Scan_Dir_Normal 0xc0
+#define COM_Scan_Dir_Reverse  0xc8
+
+#define Set_Resistor_Ratio_X   0x20
+#define Set_Ref_Vol_Mode       0x81
+#define Set_Ref_Vol_Reg        0x20
+
+#define Display_Normal    0xa6
+#define Display_Reverse   0xa7
+#define Display_All_On    0xa5
+#define Display_All_Normal  0xa4
+// ZYMG12864
+#ifdef LCD_HOST
+/*host build: the bus goes to the ST7565 emulator in Host/*/
+#include "st7565_emu.h"
+#else
+/*A0=0  -- cmd*/
+#define LCD_Command  *((volatile unsigned char * )0x6c000000)
+/*A0=1 -- data*/
+#define LCD_Data  *((volatile unsigned char * )0x6c000001)
+#endif
+
+/*DMA channel streaming the framebuffer to LCD_Data (memory-to-memory)*/
+#define LCD_DMA_CHANNEL   DMA1_Channel6
+#define LCD_DMA_IRQn      DMA1_Channel6_IRQn
+
+/*ST7565 8080-interface timing (ns), datasheet minimums at VDD = 3.3V*/
+#define LCD_T_CYC_NS      240   // tCYC8 -- system cycle time
+#define LCD_T_WR_LOW_NS   80    // tCCLW -- /WR low pulse width
+#define LCD_T_RD_LOW_NS   140   // tCCLR -- /RD low pulse width (covers tACC8)
+#define LCD_T_HIGH_NS     80    // tCCHW/tCCHR -- /WR, /RD high pulse width
+
+/*display geometry: 128 columns x 8 pages of 8 rows*/
+#define LCD_WIDTH   128
+#define LCD_HEIGHT  64
+#define LCD_PAGES   8
+
+/*tile map: 16 cells of 8 columns per page, a tile is an 8-byte half glyph*/
+#define LCD_TILE_COLS            (LCD_WIDTH / 8)
+#define LCD_TILE(glyph, half)    ((unsigned short)((glyph) * 2 + (half)))  // half 0 = upper 8 rows
+#define LCD_TILE_NONE            0xFFFF                                     // cell not owned by the tile map
+
+/*font glyph offsets (D0..D9, Da..Dz, DA..DZ, ...), sprite and image IDs and
+  descriptors, generated from Tools/assets/ by Tools/spritec.py*/
+#include "sprites.h"
+
+/*text functions: characters per line in the 8x16 font, aligned columns*/
+#define LCD_TEXT_MAX     (LCD_WIDTH / 8)
+#define LCD_TEXT_CENTER  0xFF   // centre the text on the line
+#define LCD_TEXT_RIGHT   0xFE   // end the text at the right edge
+
+/*unchanged columns the frame diff sends to join two changed runs, see LCD_SetDiffGap()*/
+#ifndef LCD_DIFF_GAP
+#define LCD_DIFF_GAP  3
+#endif
+
+/*1: keep the 7 shifted copies of every preshift sprite frame in RAM, so
+  LCD_BlitSprite() below a page boundary is a masked copy without shifts;
+  0: shift every column while blitting and save LCD_SHIFT_CACHE_BYTES of RAM*/
+#ifndef LCD_SHIFT_CACHE
+#define LCD_SHIFT_CACHE  1
+#endif
+
+#if LCD_SHIFT_CACHE
+#define LCD_SHIFT_CACHE_BYTES  (LCD_SHIFT_FRAMES * 7 * 3 * LCD_SHIFT_WIDTH)
+#else
+#define LCD_SHIFT_CACHE_BYTES  0
+#endif
+
+/*LCD bus transaction counters, see LCD_ResetBusStats()*/
+typedef struct
+{
+  unsigned long commands;     // command bytes written (A0=0)
+  unsigned long dataWrites;   // display data bytes written (A0=1)
+  unsigned long dataReads;    // display data bytes read, dummy reads included
+} LCD_BusStatsTypeDef;
+
+/*flush cost of the presented frames, see LCD_ResetFrameStats()*/
+typedef struct
+{
+  unsigned long frames;        // frames presented by LCD_SwapBuffers()
+  unsigned long commands;      // address commands sent, 3 per run
+  unsigned long bytes;         // display data bytes sent
+  unsigned long lastCommands;  // the same for the last frame only
+  unsigned long lastBytes;
+} LCD_FrameStatsTypeDef;
+
+/*raster operations of the sprite blitter, see LCD_Blit()*/
+typedef enum
+{
+  LCD_BLIT_COPY = 0,    // replace the pixels covered by the mask
+  LCD_BLIT_OR,          // set the pixels set in the sprite
+  LCD_BLIT_ANDNOT,      // clear the pixels set in the sprite
+  LCD_BLIT_XOR,         // invert the pixels set in the sprite
+  LCD_BLIT_INVERT       // like COPY with the sprite pixels inverted
+} LCD_BlitModeTypeDef;
+
+/*compositor layers, merged bottom to top; the tile map is the HUD above them*/
+typedef enum
+{
+  LCD_LAYER_BACKGROUND = 0,   // opaque: ground, decorations, text
+  LCD_LAYER_PLAYFIELD,        // moving sprites, cleared pixels are transparent
+  LCD_LAYER_COUNT
+} LCD_LayerTypeDef;
+
+extern LCD_BusStatsTypeDef LCD_BusStats;
+extern LCD_FrameStatsTypeDef LCD_FrameStats;
+extern DMA_HandleTypeDef hdma_lcd;
+
+unsigned char LCD_DrawString(unsigned char Xpos, unsigned char Ypos, const unsigned char *c, unsigned char length);
+void LCD_Init(void);
+void STM3210E_LCD_Init(void);
+void Converse_Logo(void);
+void LCD_Clear(void);
+
+// LCD_ClearPages() blanks a page range on the LCD and in RAM right away,
+// LCD_ClearBuffer() only in RAM and leaves the bus to the next frame diff
+void LCD_ClearPages(unsigned char first, unsigned char last);
+void LCD_ClearBuffer(void);
+
+void LCD_DrawChar(unsigned char Xpos, unsigned char Ypos, unsigned char offset);
+
+// Text in the 8x16 font: ASCII is mapped to glyphs through LCD_AsciiGlyphs[],
+// a string is drawn as one row per page; the column may be LCD_TEXT_CENTER
+// or LCD_TEXT_RIGHT
+unsigned char LCD_TextGlyphs(const char *s, unsigned char *glyphs, unsigned char max);
+unsigned int LCD_TextWidth(const char *s);
+unsigned char LCD_DrawText(unsigned char Xpage, unsigned char YCol, const char *s);
+unsigned char LCD_Sprintf(char *buf, unsigned char size, const char *fmt, ...);
+unsigned char LCD_Printf(unsigned char Xpage, unsigned char YCol, const char *fmt, ...);
+
+// HUD text in the proportional small font (Tools/assets/hud_font.txt), drawn
+// into a single page, same column rules as LCD_DrawText()
+unsigned int LCD_SmallTextWidth(const char *s);
+unsigned char LCD_DrawSmallText(unsigned char Xpage, unsigned char YCol, const char *s);
+unsigned char LCD_SmallPrintf(unsigned char Xpage, unsigned char YCol, const char *fmt, ...);
+
+// Sprite blitter: x = column, y = pixel row, both may lie partly off screen
+unsigned char LCD_Blit(int x, int y, const unsigned char *image, const unsigned char *mask,
+                       unsigned char width, unsigned char pages, LCD_BlitModeTypeDef mode);
+unsigned char LCD_BlitString(int x, int y, const unsigned char *c, unsigned char length, LCD_BlitModeTypeDef mode);
+const unsigned char *LCD_SpriteFrame(LCD_SpriteIdTypeDef id, unsigned char frame);
+unsigned char LCD_BlitSprite(int x, int y, LCD_SpriteIdTypeDef id, unsigned char frame, LCD_BlitModeTypeDef mode);
+unsigned char LCD_DrawImage(int x, unsigned char page, LCD_ImageIdTypeDef id, LCD_BlitModeTypeDef mode);
+
+// Double-buffered shadow framebuffer: drawing functions only touch layers in
+// RAM and record the touched column runs, LCD_SwapBuffers() sorts and merges
+// the runs, composites them, diffs them against what the LCD shows and DMAs
+// each changed run to the controller with one address setup, LCD_Flush()
+// also waits for it
+void LCD_Flush(void);
+void LCD_SwapBuffers(void);
+unsigned char LCD_FlushBusy(void);
+void LCD_FlushWait(void);
+void LCD_Invalidate(void);
+void LCD_SetDiffGap(unsigned char gap);
+void LCD_SetReverse(unsigned char on);
+void LCD_WritePage(unsigned char page, unsigned char col, const unsigned char *data, unsigned char len);
+
+// Compositor: drawing goes to the selected layer, layers are merged over
+// the changed spans at LCD_SwapBuffers()
+void LCD_SelectLayer(LCD_LayerTypeDef layer);
+
+// Tile map (HUD layer) for grid-aligned content, rendered on top at LCD_SwapBuffers()
+void LCD_TileSet(unsigned char page, unsigned char cell, unsigned short tile);
+void LCD_TileSetString(unsigned char page, unsigned char cell, const unsigned char *c, unsigned char length);
+void LCD_TileRender(void);
+void LCD_TileClear(void);
+void LCD_ResetBusStats(void);
+void LCD_ResetFrameStats(void);
+
+// Direct display RAM access in RMW mode, bypassing the framebuffer
+unsigned char LCD_DirectSetArea(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
+unsigned char LCD_DirectSetPixel(unsigned char x, unsigned char y, unsigned char state);
+
+void LCD_PowerOn(void);
+void LCD_DisplayOn(void);
+void LCD_DisplayOff(void);
+
+void LCD_CtrlLinesConfig(void);
+void LCD_FSMCConfig(void);
+void LCD_DMAConfig(void);
+
+unsigned long LCD_GetBusCycles(void);
+
+void reset_delay(void);
+void power_delay(void);
+
+void LCD_Draw_ST_Logo(void);
+void LCD_Reset_Cursor(void);
+void LCD_Clr_Cursor(signed char x);
+void LCD_Set_Cursor(signed char x);
+
+// Pixel control functions
+unsigned char LCD_SetPixel(unsigned char x, unsigned char y, unsigned char state);
+unsigned char LCD_DrawLine(unsigned char x1, unsigned char x2, unsigned char y, unsigned char state);
+unsigned char LCD_DrawVLine(unsigned char x, unsigned char y1, unsigned char y2, unsigned char state);
+unsigned char LCD_DrawLineAngle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char state);
+unsigned char LCD_DrawRect(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
+unsigned char LCD_FillRect(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
+unsigned char LCD_DrawCircle(unsigned char xc, unsigned char yc, unsigned char radius, unsigned char state);
+unsigned char LCD_FillCircle(unsigned char xc, unsigned char yc, unsigned char radius, unsigned char state);
+unsigned char LCD_DrawTriangle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
+unsigned char LCD_FillTriangle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
+unsigned char LCD_SetArea(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state);
+
+#endif /* __LCD_H */
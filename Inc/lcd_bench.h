@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ * @file    lcd_bench.h
+ * @brief   On-target LCD driver benchmarks, timed with the DWT cycle counter
+ ******************************************************************************
+ */
+
+#ifndef __LCD_BENCH_H
+#define __LCD_BENCH_H
+
+#include "lcd.h"
+
+/* Uncomment to run the LCD benchmarks at startup and print them over UART */
+//#define LCD_BENCHMARK
+
+/* Repetitions of the line/rectangle/circle set in LCD_Bench_Primitives() */
+#define LCD_BENCH_PRIMITIVE_SETS  10
+
+/* Rectangles filled per method in LCD_Bench_DirectSetArea() */
+#define LCD_BENCH_RECTS  10
+
+/* Logo draws per method in LCD_Bench_DrawImage() */
+#define LCD_BENCH_IMAGES  10
+
+/* Passes over all dino frames and rows in LCD_Bench_SpriteShift() */
+#define LCD_BENCH_SHIFT_PASSES  10
+
+/* Full-screen clears per method in LCD_Bench_Clear() */
+#define LCD_BENCH_CLEARS  10
+
+// One benchmark measurement: count operations took cycles HCLK cycles
+typedef struct {
+    unsigned long count;          // operations (bytes, primitives, ...) done
+    unsigned long cycles;         // HCLK cycles taken
+} LCD_BenchResultTypeDef;
+
+void LCD_Bench_Init(void);
+unsigned long LCD_Bench_PerSecond(const LCD_BenchResultTypeDef *result);
+unsigned long LCD_Bench_BusLimit(void);
+
+void LCD_Bench_FullScreenWrite(LCD_BenchResultTypeDef *result);
+void LCD_Bench_FullScreenFlush(LCD_BenchResultTypeDef *result);
+void LCD_Bench_Primitives(LCD_BenchResultTypeDef *legacy, LCD_BenchResultTypeDef *framebuffer);
+void LCD_Bench_DirectSetArea(LCD_BenchResultTypeDef *legacy, LCD_BenchResultTypeDef *rmw);
+void LCD_Bench_DrawImage(LCD_BenchResultTypeDef *raw, LCD_BenchResultTypeDef *rle);
+void LCD_Bench_SpriteShift(LCD_BenchResultTypeDef *shifting, LCD_BenchResultTypeDef *cached);
+void LCD_Bench_Clear(LCD_BenchResultTypeDef *flush, LCD_BenchResultTypeDef *fill);
+
+#endif /* __LCD_BENCH_H */
@@ -0,0 +1,145 @@
+/* Generated by Tools/spritec.py from Tools/assets/font.txt, Tools/assets/sprites.txt, Tools/assets/logo.txt, Tools/assets/hud_font.txt, do not edit */
+#ifndef __SPRITES_H
+#define __SPRITES_H
+
+/*sprite descriptor, see LCD_BlitSprite()*/
+typedef struct
+{
+  unsigned char width;      // pixels, drawn as width/8 glyphs rounded up
+  unsigned char height;     // pixels, at most 16
+  unsigned char frames;     // animation frames
+  unsigned char glyphs;     // first entry of frame 0 in LCD_SpriteGlyphs[]
+  unsigned char hitbox[4];  // collision box: left, top, right, bottom pixel
+  unsigned char shifted;    // frame 0 in the shift cache, LCD_SPRITE_NOT_SHIFTED: none
+} LCD_SpriteTypeDef;
+
+/*pre-shifted sprite frames (preshift in the assets), see LCD_SHIFT_CACHE*/
+#define LCD_SHIFT_FRAMES        5
+#define LCD_SHIFT_WIDTH         16
+#define LCD_SPRITE_NOT_SHIFTED  0xFF
+
+/*image descriptor, see LCD_DrawImage()*/
+typedef struct
+{
+  unsigned char width;        // pixels
+  unsigned char pages;        // height in pages of 8 rows
+  unsigned char rle;          // 1: data is run-length encoded, see Tools/spritec.py
+  const unsigned char *data;  // page by page, left to right, bit 0 on top
+} LCD_ImageTypeDef;
+
+/*HUD font glyph, see LCD_DrawSmallText()*/
+typedef struct
+{
+  unsigned char offset;  // first column in LCD_SmallFontData[]
+  unsigned char width;   // columns, drawn with one blank column after them
+} LCD_SmallGlyphTypeDef;
+
+/*font glyphs, offsets in ChineseTable[]*/
+#define D0     0
+#define D1     1
+#define D2     2
+#define D3     3
+#define D4     4
+#define D5     5
+#define D6     6
+#define D7     7
+#define D8     8
+#define D9     9
+#define DPoint 10
+#define DDash  11
+#define DColon 12
+#define DSpace 13
+#define Da     14
+#define Db     15
+#define Dc     16
+#define Dd     17
+#define De     18
+#define Df     19
+#define Dg     20
+#define Dh     21
+#define Di     22
+#define Dj     23
+#define Dk     24
+#define Dl     25
+#define Dm     26
+#define Dn     27
+#define Do     28
+#define Dp     29
+#define Dq     30
+#define Dr     31
+#define Ds     32
+#define Dt     33
+#define Du     34
+#define Dv     35
+#define Dw     36
+#define Dx     37
+#define Dy     38
+#define Dz     39
+#define DA     40
+#define DB     41
+#define DC     42
+#define DD     43
+#define DE     44
+#define DF     45
+#define DG     46
+#define DH     47
+#define DI     48
+#define DJ     49
+#define DK     50
+#define DL     51
+#define DM     52
+#define DN     53
+#define DO     54
+#define DP     55
+#define DQ     56
+#define DR     57
+#define DS     58
+#define DT     59
+#define DU     60
+#define DV     61
+#define DW     62
+#define DX     63
+#define DY     64
+#define DZ     65
+#define HUD_HI 66
+
+/*sprite IDs, index of the descriptor in LCD_Sprites[]*/
+typedef enum
+{
+  SPRITE_CACTUS_BIG = 0,
+  SPRITE_CACTUS_SMALL,
+  SPRITE_DINO_STAND,
+  SPRITE_DINO_RUN,        // 2 frames
+  SPRITE_DINO_CROUCH,     // 2 frames
+  SPRITE_DINO_HIT,
+  SPRITE_DINO_DEAD,
+  SPRITE_BIRD_FLY,        // 2 frames
+  SPRITE_STAR,
+  SPRITE_MOON,
+  SPRITE_CLOUD,
+  SPRITE_GROUND_LINE,     // 4 frames
+  SPRITE_COUNT
+} LCD_SpriteIdTypeDef;
+
+/*image IDs, index of the descriptor in LCD_Images[]*/
+typedef enum
+{
+  IMAGE_ST_LOGO = 0,
+  IMAGE_COUNT
+} LCD_ImageIdTypeDef;
+
+#define LCD_GLYPH_COUNT  97
+
+/*printable ASCII characters in LCD_AsciiGlyphs[]*/
+#define LCD_ASCII_FIRST  0x20
+#define LCD_ASCII_LAST   0x7E
+
+extern const unsigned char ChineseTable[][16];
+extern const unsigned char LCD_SpriteGlyphs[];
+extern const LCD_SpriteTypeDef LCD_Sprites[];
+extern const LCD_ImageTypeDef LCD_Images[];
+extern const unsigned char LCD_AsciiGlyphs[];
+extern const unsigned char LCD_SmallFontData[];
+extern const LCD_SmallGlyphTypeDef LCD_SmallFont[];
+
+#endif /* __SPRITES_H */
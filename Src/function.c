@@ -1,444 +1,484 @@
-/**
- ******************************************************************************
- * @file    function.c
- * @brief   Chrome Dino Game - Game mechanics and sprite rendering
- * @author  Your Name
- * @date    November 20, 2025
- ******************************************************************************
- * 
- * CHROME DINO GAME IMPLEMENTATION GUIDE
- * ======================================
- * 
- * This file contains all the game mechanics and sprite rendering functions
- * for a Chrome Dino-style endless runner game on the STM32 EK-STM3210E LCD.
- * 
- ******************************************************************************
- */
-
-#include "function.h"
-#include "lcd.h"
-#include "string.h"
-
-// Ground pattern - creates varied terrain that scrolls
-static const unsigned char groundPattern[GROUND_PATTERN_LENGTH] = {
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE_4,
-    SPRITE_GROUND_LINE_3,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE_2,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE_4,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE_3,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE,
-    SPRITE_GROUND_LINE_2,
-};
-
-// Initialize game state
-void initGameState(DinoGameState *state) {
-    state->dinoX = GROUND_PAGE - GROUND_OFFSET;
-    state->dinoY = 8;
-    state->animFrame = 0;
-    state->jumpHeight = 0;
-    state->isJumping = 0;
-    state->isCrouching = 0;
-    state->jumpVelocity = 0;
-    state->jumpFrameCounter = 0;
-    state->lives = 1;
-    state->score = 0;
-    state->currentSpeed = OBSTACLE_SPEED_INIT;
-    state->speedTimer = 0;
-    state->groundOffset = 0;
-}
-
-// Draw the dino at current state position
-void drawDino(DinoGameState *state) {
-    unsigned char sprite[2];  // Array for 16x16 sprite (2 chars wide)
-    
-    // Select sprite based on state
-    // 16x16 sprites use 2 consecutive indices (e.g., 125 and 126)
-    if (state->isCrouching) {
-        // Alternate between crouch frames for crouching animation
-        if (state->animFrame % 8 < 4) {
-            sprite[0] = SPRITE_DINO_CROUCH;      // Index 144
-            sprite[1] = SPRITE_DINO_CROUCH + 1;  // Index 145
-        } else {
-            sprite[0] = SPRITE_DINO_CROUCH_2;      // Index 146
-            sprite[1] = SPRITE_DINO_CROUCH_2 + 1;  // Index 147
-        }
-    } else if (state->isJumping) {
-        sprite[0] = SPRITE_DINO_STAND;      // Index 125
-        sprite[1] = SPRITE_DINO_STAND + 1;  // Index 126
-    } else {
-        // Alternate between run frames for running animation
-        if (state->animFrame % 8 < 4) {
-            sprite[0] = SPRITE_DINO_RUN;      // Index 127
-            sprite[1] = SPRITE_DINO_RUN + 1;  // Index 128
-        } else {
-            sprite[0] = SPRITE_DINO_RUN_2;      // Index 129
-            sprite[1] = SPRITE_DINO_RUN_2 + 1;  // Index 130
-        }
-    }
-    
-    // Draw the dino (16x16 sprite using 2 consecutive 8x16 chars)
-    LCD_DrawString(state->dinoX, state->dinoY, sprite, 2);
-}
-
-// Draw dead dino sprite at current position
-void drawDinoDead(DinoGameState *state) {
-    unsigned char sprite[2];
-    sprite[0] = SPRITE_DINO_DEAD;      // Index 131
-    sprite[1] = SPRITE_DINO_DEAD + 1;  // Index 132
-    LCD_DrawString(state->dinoX, state->dinoY, sprite, 2);
-}
-
-// Draw dino hit sprite at current position (when losing a life but not dead)
-void drawDinoHit(DinoGameState *state) {
-    unsigned char sprite[2];
-    sprite[0] = SPRITE_DINO_HIT;      // Index 142
-    sprite[1] = SPRITE_DINO_HIT + 1;  // Index 143
-    LCD_DrawString(state->dinoX, state->dinoY, sprite, 2);
-}
-
-// Update dino animation frame
-void updateDinoAnimation(DinoGameState *state) {
-    state->animFrame++;
-    if (state->animFrame > 100) {
-        state->animFrame = 0;  // Reset to prevent overflow
-    }
-}
-
-// Handle jump mechanics with smooth velocity-based animation
-// Uses velocity that decreases going up (deceleration) and increases going down (gravity)
-// Pressing crouch during jump will cancel and fall immediately (fast-fall)
-void handleJump(DinoGameState *state) {
-    // Check if crouch button pressed during jump - fast-fall immediately
-    if (state->isCrouching && (state->isJumping || state->jumpHeight > 0)) {
-        state->isJumping = 0;
-        state->jumpVelocity = 0;
-        state->jumpFrameCounter = 0;
-        // Fast-fall: drop all remaining height at once
-        while (state->jumpHeight > 0) {
-            state->jumpHeight--;
-            state->dinoX++;  // Move down one page
-        }
-        return;
-    }
-    
-    // Start jump with initial velocity
-    if (state->isJumping && state->jumpVelocity == 0 && state->jumpHeight == 0) {
-        state->jumpVelocity = JUMP_INITIAL_VELOCITY;
-        state->jumpFrameCounter = 0;
-    }
-    
-    // Process jump physics
-    if (state->jumpVelocity > 0) {
-        // Going up - move every (5 - velocity) frames for variable speed
-        // Higher velocity = move more frequently (faster)
-        state->jumpFrameCounter++;
-        unsigned char framesPerMove = 6 - state->jumpVelocity;
-        if (framesPerMove < 1) framesPerMove = 1;
-        
-        if (state->jumpFrameCounter >= framesPerMove) {
-            state->jumpFrameCounter = 0;
-            if (state->jumpHeight < JUMP_MAX_HEIGHT) {
-                state->jumpHeight++;
-                state->dinoX--;  // Move up one page
-            }
-            // Apply gravity - reduce upward velocity
-            state->jumpVelocity -= JUMP_GRAVITY;
-            
-            // If velocity becomes 0 or negative, start falling
-            if (state->jumpVelocity <= 0) {
-                state->isJumping = 0;
-                state->jumpVelocity = -1;  // Start falling slowly
-            }
-        }
-    } else if (state->jumpVelocity < 0 || (state->jumpHeight > 0 && !state->isJumping)) {
-        // Falling down - accelerate with gravity
-        if (state->jumpVelocity == 0) state->jumpVelocity = -1;
-        
-        state->jumpFrameCounter++;
-        // Falling speed increases (velocity becomes more negative)
-        unsigned char framesPerMove = 5 + state->jumpVelocity;  // velocity is negative, so this decreases
-        if (framesPerMove < 1) framesPerMove = 1;
-        if (framesPerMove > 4) framesPerMove = 4;  // Cap slowest fall speed
-        
-        if (state->jumpFrameCounter >= framesPerMove) {
-            state->jumpFrameCounter = 0;
-            if (state->jumpHeight > 0) {
-                state->jumpHeight--;
-                state->dinoX++;  // Move down one page
-                // Accelerate falling (make velocity more negative)
-                if (state->jumpVelocity > -JUMP_INITIAL_VELOCITY) {
-                    state->jumpVelocity -= JUMP_GRAVITY;
-                }
-            } else {
-                // Landed
-                state->jumpVelocity = 0;
-                state->jumpFrameCounter = 0;
-            }
-        }
-    }
-}
-
-// Draw a cactus obstacle
-void drawCactus(unsigned char x, unsigned char y, unsigned char type) {
-    unsigned char sprite[2];
-    if (type == 0) {
-        // Big cactus (16x16)
-        sprite[0] = SPRITE_CACTUS_BIG;
-        sprite[1] = SPRITE_CACTUS_BIG + 1;
-        LCD_DrawString(x, y, sprite, 2);
-    } else {
-        // Small cactus (8x16)
-        sprite[0] = SPRITE_CACTUS_SMALL;
-        LCD_DrawString(x, y, sprite, 1);
-    }
-}
-
-// Draw a flying bird with animation
-void drawBird(unsigned char x, unsigned char y, unsigned char animFrame) {
-    unsigned char sprite[2];
-    // Alternate between two bird frames for flapping animation
-    if (animFrame % 8 < 4) {
-        sprite[0] = SPRITE_BIRD_FLY_1;
-        sprite[1] = SPRITE_BIRD_FLY_1 + 1;
-    } else {
-        sprite[0] = SPRITE_BIRD_FLY_2;
-        sprite[1] = SPRITE_BIRD_FLY_2 + 1;
-    }
-    LCD_DrawString(x, y, sprite, 2);
-}
-
-// Draw a star decoration
-void drawStar(unsigned char x, unsigned char y) {
-    unsigned char sprite[2] = {SPRITE_STAR, SPRITE_STAR + 1};
-    LCD_DrawString(x, y, sprite, 2);
-}
-
-// Draw a cloud decoration
-void drawCloud(unsigned char x, unsigned char y) {
-    unsigned char sprite[2] = {SPRITE_CLOUD, SPRITE_CLOUD + 1};
-    LCD_DrawString(x, y, sprite, 2);
-}
-
-// Draw a moon decoration
-void drawMoon(unsigned char x, unsigned char y) {
-    unsigned char sprite[2] = {SPRITE_MOON, SPRITE_MOON + 1};
-    LCD_DrawString(x, y, sprite, 2);
-}
-
-// Draw ground line (full width) - static, no scrolling
-void drawGroundLine(unsigned char page) {
-    // Draw a continuous line across the entire width at GROUND_PAGE
-    // Use SPRITE_GROUND_LINE (145) which has the line in the bottom byte
-    unsigned char sprite[1] = {SPRITE_GROUND_LINE};
-    for (unsigned char i = 0; i < 16; i++) {  // 128 pixels / 8 = 16 sprites
-        LCD_DrawString(page, i * 8, sprite, 1);
-    }
-}
-
-// Draw ground line with scrolling pattern (internal use)
-static void drawGroundLineScrolling(unsigned char page, unsigned char offset) {
-    for (unsigned char i = 0; i < 16; i++) {
-        unsigned char patternIndex = (i + offset) % GROUND_PATTERN_LENGTH;
-        unsigned char sprite[1] = {groundPattern[patternIndex]};
-        LCD_DrawString(page, i * 8, sprite, 1);
-    }
-}
-
-// Update ground scroll offset (call this when obstacles move)
-void updateGroundScroll(DinoGameState *state) {
-    state->groundOffset++;
-    if (state->groundOffset >= GROUND_PATTERN_LENGTH) {
-        state->groundOffset = 0;
-    }
-}
-
-// Draw ground line while avoiding dino and obstacle positions
-// This prevents the ground line from erasing the bottom half of sprites
-// Uses scrolling pattern based on dino's groundOffset
-void drawGroundLineAvoidSprites(unsigned char page, DinoGameState *dino, Obstacle *obstacles, unsigned char numObstacles) {
-    // Create a mask of columns to skip (each bit = one 8-pixel block)
-    // We have 16 blocks (128 pixels / 8 = 16)
-    unsigned short skipMask = 0;
-    
-    // Mark dino's columns to skip (dino is 16 pixels wide = 2 blocks)
-    // Only skip if dino is on a page that overlaps with ground line
-    if (dino->dinoX >= page - 1 && dino->dinoX <= page) {
-        unsigned char dinoBlock = dino->dinoY / 8;
-        if (dinoBlock < 16) skipMask |= (1 << dinoBlock);
-        if (dinoBlock + 1 < 16) skipMask |= (1 << (dinoBlock + 1));
-    }
-    
-    // Mark obstacle columns to skip
-    for (unsigned char i = 0; i < numObstacles; i++) {
-        if (obstacles[i].active) {
-            // Only skip if obstacle is on a page that overlaps with ground line
-            // Ground-based obstacles (cactus) are at GROUND_PAGE - GROUND_OFFSET
-            if (obstacles[i].x >= page - 1 && obstacles[i].x <= page) {
-                unsigned char obsBlock = obstacles[i].y / 8;
-                if (obsBlock < 16) skipMask |= (1 << obsBlock);
-                // Only skip second block for 16-pixel wide sprites (big cactus, type 0)
-                // Small cactus (type 1) is only 8 pixels wide = 1 block
-                if (obstacles[i].type != 1) {
-                    if (obsBlock + 1 < 16) skipMask |= (1 << (obsBlock + 1));
-                }
-            }
-        }
-    }
-    
-    // Draw ground line with scrolling pattern, skipping marked columns
-    for (unsigned char i = 0; i < 16; i++) {
-        if (!(skipMask & (1 << i))) {
-            // Get sprite from pattern with offset for scrolling effect
-            unsigned char patternIndex = (i + dino->groundOffset) % GROUND_PATTERN_LENGTH;
-            unsigned char sprite[1] = {groundPattern[patternIndex]};
-            LCD_DrawString(page, i * 8, sprite, 1);
-        }
-    }
-}
-
-// Animate ground line entry from right to left (blocking animation for start screen)
-// This creates a cool starting effect where the ground "rolls in" from the right
-// The dino runs in place while waiting for the ground to arrive
-void animateGroundLineEntry(unsigned char page, DinoGameState *dino) {
-    unsigned char sprite[1] = {SPRITE_GROUND_LINE};
-    
-    // Draw dino first before ground animation starts
-    drawDino(dino);
-    
-    // Start from rightmost position and draw progressively to the left
-    // Each step adds one more 8-pixel block from the right
-    for (int col = 15; col >= 0; col--) {
-        // Update dino animation frame
-        updateDinoAnimation(dino);
-        
-        // Redraw dino with updated animation
-        clearSprite(dino->dinoX, dino->dinoY, 2);
-        drawDino(dino);
-        
-        // Draw ground line from current column to the right edge
-        // Skip the dino's columns to avoid overwriting its bottom half
-        unsigned char dinoStartBlock = dino->dinoY / 8;
-        for (int i = col; i < 16; i++) {
-            // Skip dino's columns (2 blocks wide)
-            if (i != dinoStartBlock && i != dinoStartBlock + 1) {
-                LCD_DrawString(page, i * 8, sprite, 1);
-            }
-        }
-        HAL_Delay(30);  // Animation delay between frames
-    }
-}
-
-// Clear a sprite area by drawing blank characters
-void clearSprite(unsigned char x, unsigned char y, unsigned char width) {
-    unsigned char blank[1] = {22};
-    for (unsigned char i = 0; i < width; i++) {
-        LCD_DrawString(x, y + (i * 8), blank, 1);
-    }
-}
-
-// Draw score using number sprites
-void drawScore(unsigned int score, unsigned char x, unsigned char y) {
-    // Convert score to digits and draw (max 3 digits)
-    unsigned char digits[3];
-    unsigned char numDigits = 0;
-    unsigned int temp = score;
-    
-    // Cap score at 999
-    if (temp > 999) temp = 999;
-    
-    // Extract digits
-    if (temp == 0) {
-        digits[0] = 0;
-        numDigits = 1;
-    } else {
-        while (temp > 0 && numDigits < 3) {
-            digits[numDigits++] = temp % 10;
-            temp /= 10;
-        }
-    }
-    
-    // Draw digits (reversed order)
-    for (int i = numDigits - 1; i >= 0; i--) {
-        unsigned char digitSprite[1] = {digits[i]};
-        LCD_DrawString(x, y + ((numDigits - 1 - i) * 8), digitSprite, 1);
-    }
-}
-
-// Draw game score in upper right corner of LCD
-// LCD is 128 pixels wide, score at page 0 (top), right-aligned
-void drawGameScore(unsigned int score) {
-    // First clear the score area (up to 3 digits = 24 pixels)
-    unsigned char blank[3] = {22, 22, 22};  // Index 22 is blank
-    LCD_DrawString(0, 104, blank, 3);  // Clear from column 104 to 128
-    
-    // Cap score at 999
-    if (score > 999) score = 999;
-    
-    // Draw score right-aligned at upper right
-    // Calculate starting position based on number of digits
-    unsigned char numDigits = 1;
-    unsigned int temp = score;
-    while (temp >= 10 && numDigits < 3) {
-        temp /= 10;
-        numDigits++;
-    }
-    
-    // Position: 128 - (numDigits * 8) for right alignment
-    unsigned char startY = 128 - (numDigits * 8);
-    drawScore(score, 0, startY);
-}
-
-// Draw "START" text in the middle of the LCD
-// ChineseTable indices: S=74, T=75, A=56, R=73, T=75
-void drawStartScreen(void) {
-    // "START" = 5 characters, each 8 pixels wide = 40 pixels
-    // LCD is 128 pixels wide, center at (128-40)/2 = 44
-    // Middle page is 3 or 4 (LCD has pages 0-7)
-    unsigned char startText[5] = {74, 75, 56, 73, 75};  // S, T, A, R, T
-    LCD_DrawString(3, 44, startText, 5);
-}
-
-// Draw "GAME OVER" text in the middle of the LCD
-// ChineseTable indices: G=62, A=56, M=68, E=60, space=22, O=70, V=77, E=60, R=73
-void drawEndScreen(void) {
-    // "GAME OVER" = 9 characters, each 8 pixels wide = 72 pixels
-    // LCD is 128 pixels wide, center at (128-72)/2 = 28
-    unsigned char gameOverText[9] = {62, 56, 68, 60, 22, 70, 77, 60, 73};  // G, A, M, E, (space), O, V, E, R
-    LCD_DrawString(3, 28, gameOverText, 9);  // GAME OVER centered on single line
-}
-
-// Update LEDs to show number of lives (1-4)
-void updateLivesLED(unsigned char lives) {
-    // LED1 = life 1, LED2 = life 2, etc.
-    // Turn ON LEDs for each life, OFF for the rest
-    HAL_GPIO_WritePin(LED4_GPIO_PORT, LED4_PIN, (lives >= 1) ? GPIO_PIN_SET : GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(LED3_GPIO_PORT, LED3_PIN, (lives >= 2) ? GPIO_PIN_SET : GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(LED2_GPIO_PORT, LED2_PIN, (lives >= 3) ? GPIO_PIN_SET : GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(LED1_GPIO_PORT, LED1_PIN, (lives >= 4) ? GPIO_PIN_SET : GPIO_PIN_RESET);
-}
-
-// Update game speed - gradually increases pace over time
-// Uses frame-based control: currentSpeed = frames between obstacle moves
-// This function should be called every frame
-void updateGameSpeed(DinoGameState *state) {
-    state->speedTimer++;
-    
-    // Check if it's time to increase speed
-    if (state->speedTimer >= SPEED_INCREASE_RATE) {
-        state->speedTimer = 0;
-        
-        // Decrease obstacle speed (lower = faster movement)
-        if (state->currentSpeed > OBSTACLE_SPEED_MIN) {
-            state->currentSpeed--;
-        }
-    }
+/**
+ ******************************************************************************
+ * @file    function.c
+ * @brief   Chrome Dino Game - Game mechanics and sprite rendering
+ * @author  Your Name
+ * @date    November 20, 2025
+ ******************************************************************************
+ * 
+ * CHROME DINO GAME IMPLEMENTATION GUIDE
+ * ======================================
+ * 
+ * This file contains all the game mechanics and sprite rendering functions
+ * for a Chrome Dino-style endless runner game on the STM32 EK-STM3210E LCD.
+ * 
+ ******************************************************************************
+ */
+
+#include "function.h"
+#include "lcd.h"
+#include "string.h"
+
+// Ground pattern - creates varied terrain that scrolls
+static const unsigned char groundPattern[GROUND_PATTERN_LENGTH] = {
+    GROUND_PLAIN,
+    GROUND_PLAIN,
+    GROUND_ROCKS,
+    GROUND_BUMP,
+    GROUND_PLAIN,
+    GROUND_PLAIN,
+    GROUND_PLAIN,
+    GROUND_PEBBLES,
+    GROUND_PLAIN,
+    GROUND_ROCKS,
+    GROUND_PLAIN,
+    GROUND_PLAIN,
+    GROUND_BUMP,
+    GROUND_PLAIN,
+    GROUND_PLAIN,
+    GROUND_PEBBLES,
+};
+
+// Initialize game state
+void initGameState(DinoGameState *state) {
+    state->dinoY = 8;
+    state->dinoRow = DINO_GROUND_ROW;
+    state->animFrame = 0;
+    state->jumpHeight = 0;
+    state->isJumping = 0;
+    state->isCrouching = 0;
+    state->jumpVelocity = 0;
+    state->jumpPos = 0;
+    state->lives = 1;
+    state->score = 0;
+    state->scrollSpeed = SCROLL_SPEED_INIT;
+    state->speedTimer = 0;
+    state->scrollPos = 0;
+    state->hitTimer = 0;
+    state->flashTimer = 0;
+}
+
+// Sprite the dino is drawn with in its current state (not hit)
+static LCD_SpriteIdTypeDef dinoSprite(const DinoGameState *state) {
+    if (state->isCrouching) {
+        return SPRITE_DINO_CROUCH;
+    }
+    return state->isJumping ? SPRITE_DINO_STAND : SPRITE_DINO_RUN;
+}
+
+// Draw the dino at current state position
+void drawDino(DinoGameState *state) {
+    // Crouch and run alternate between their two frames every 4 animation steps
+    unsigned char frame = state->animFrame % 8 >= 4;
+    
+    // After a hit: the hit sprite first, then the dino blinks until the
+    // invulnerability frames run out (the caller cleared it already)
+    if (state->hitTimer > HIT_INVULNERABLE_FRAMES - HIT_SPRITE_FRAMES) {
+        drawDinoHit(state);
+        return;
+    }
+    if (state->hitTimer % HIT_BLINK_FRAMES >= HIT_BLINK_FRAMES / 2) {
+        return;
+    }
+    
+    // Draw the dino (16x16 sprite) on the playfield layer,
+    // the ground below its feet stays intact
+    LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+    LCD_BlitSprite(state->dinoY, state->dinoRow, dinoSprite(state), frame, LCD_BLIT_OR);
+}
+
+// Draw dead dino sprite at current position
+void drawDinoDead(DinoGameState *state) {
+    LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+    LCD_BlitSprite(state->dinoY, state->dinoRow, SPRITE_DINO_DEAD, 0, LCD_BLIT_OR);
+}
+
+// Draw dino hit sprite at current position (when losing a life but not dead)
+void drawDinoHit(DinoGameState *state) {
+    LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+    LCD_BlitSprite(state->dinoY, state->dinoRow, SPRITE_DINO_HIT, 0, LCD_BLIT_OR);
+}
+
+// Update dino animation frame
+void updateDinoAnimation(DinoGameState *state) {
+    state->animFrame++;
+    if (state->animFrame > 100) {
+        state->animFrame = 0;  // Reset to prevent overflow
+    }
+}
+
+// Handle jump mechanics with a pixel-precise ballistic arc
+// Height and velocity are kept in 1/16 pixel fixed point: velocity starts at
+// JUMP_INITIAL_VELOCITY and loses JUMP_GRAVITY every frame. The height is
+// capped at JUMP_MAX_HEIGHT pages, which gives the short hang time at the top
+// Pressing crouch during jump will cancel and fall immediately (fast-fall)
+void handleJump(DinoGameState *state) {
+    // Check if crouch button pressed during jump - fast-fall immediately
+    if (state->isCrouching && (state->isJumping || state->jumpPos > 0)) {
+        state->isJumping = 0;
+        state->jumpVelocity = 0;
+        state->jumpPos = 0;
+    }
+    
+    // Start jump with initial velocity
+    if (state->isJumping && state->jumpVelocity == 0 && state->jumpPos == 0) {
+        state->jumpVelocity = JUMP_INITIAL_VELOCITY;
+    }
+    
+    // Process jump physics while airborne
+    if (state->jumpVelocity != 0 || state->jumpPos > 0) {
+        state->jumpPos += state->jumpVelocity;
+        if (state->jumpPos > (JUMP_MAX_HEIGHT * 8) << JUMP_FIXED_SHIFT) {
+            state->jumpPos = (JUMP_MAX_HEIGHT * 8) << JUMP_FIXED_SHIFT;
+        }
+        
+        // Apply gravity, keep the velocity within signed char range
+        if (state->jumpVelocity > -JUMP_INITIAL_VELOCITY) {
+            state->jumpVelocity -= JUMP_GRAVITY;
+        }
+        
+        // Past the top of the arc, start falling
+        if (state->jumpVelocity <= 0) {
+            state->isJumping = 0;
+        }
+        
+        if (state->jumpPos <= 0) {
+            // Landed
+            state->jumpPos = 0;
+            state->jumpVelocity = 0;
+        }
+    }
+    
+    // Pixel height drives drawing and collisions
+    state->jumpHeight = state->jumpPos >> JUMP_FIXED_SHIFT;
+    state->dinoRow = DINO_GROUND_ROW - state->jumpHeight;
+}
+
+// Draw a cactus obstacle (x = page, y = column, may be partly off screen)
+void drawCactus(unsigned char x, int y, unsigned char type) {
+    // type 0: big cactus (16x16), otherwise small cactus (8x16)
+    LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+    LCD_BlitSprite(y, x * 8, type == 0 ? SPRITE_CACTUS_BIG : SPRITE_CACTUS_SMALL, 0, LCD_BLIT_OR);
+}
+
+// Check whether the dino touches an obstacle: the hitboxes of both sprite
+// descriptors (Tools/assets/sprites.txt) are placed where the sprites are
+// drawn and tested for overlap. Cacti are jumped over, the high bird is only
+// reached by a jump and the low bird is passed crouching
+unsigned char checkCollision(const DinoGameState *state, const Obstacle *obstacle) {
+    const unsigned char *dino = LCD_Sprites[dinoSprite(state)].hitbox;
+    const unsigned char *box = LCD_Sprites[obstacle->type >= 2 ? SPRITE_BIRD_FLY :
+                                           obstacle->type == 0 ? SPRITE_CACTUS_BIG : SPRITE_CACTUS_SMALL].hitbox;
+    int row = obstacle->x * 8;
+    
+    // hitbox[]: left, top, right, bottom pixel of the sprite
+    return obstacle->y + box[0] <= state->dinoY + dino[2] &&
+           obstacle->y + box[2] >= state->dinoY + dino[0] &&
+           row + box[1] <= state->dinoRow + dino[3] &&
+           row + box[3] >= state->dinoRow + dino[1];
+}
+
+// Draw a flying bird with animation
+void drawBird(unsigned char x, int y, unsigned char animFrame) {
+    // Alternate between two bird frames for flapping animation
+    LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+    LCD_BlitSprite(y, x * 8, SPRITE_BIRD_FLY, animFrame % 8 >= 4, LCD_BLIT_OR);
+}
+
+// Draw a star decoration
+void drawStar(unsigned char x, int y) {
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    LCD_BlitSprite(y, x * 8, SPRITE_STAR, 0, LCD_BLIT_OR);
+}
+
+// Draw a cloud decoration
+void drawCloud(unsigned char x, int y) {
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    LCD_BlitSprite(y, x * 8, SPRITE_CLOUD, 0, LCD_BLIT_OR);
+}
+
+// Draw a moon decoration
+void drawMoon(unsigned char x, int y) {
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    LCD_BlitSprite(y, x * 8, SPRITE_MOON, 0, LCD_BLIT_OR);
+}
+
+// Sky decorations: page, column at scroll position 0, 16x16 sprite ID
+// They start below the HUD on HUD_PAGE
+static const unsigned char skyDecorations[][3] = {
+    {HUD_PAGE + 1, 20, SPRITE_CLOUD},
+    {HUD_PAGE + 1, 50, SPRITE_MOON},
+    {HUD_PAGE + 2, 60, SPRITE_CLOUD},
+    {HUD_PAGE + 1, 80, SPRITE_CLOUD},
+};
+#define SKY_DECORATIONS (sizeof(skyDecorations) / sizeof(skyDecorations[0]))
+
+// Sky scroll offset in pixels for a scroll position, parallax applied
+static unsigned int skyOffset(unsigned int scrollPos) {
+    return (scrollPos >> (SCROLL_FIXED_SHIFT + SKY_PARALLAX_SHIFT)) % SKY_WIDTH;
+}
+
+// Column of a sky decoration at a sky offset (-16 to 127)
+static int skyColumn(unsigned int offset, unsigned char i) {
+    return (int)((skyDecorations[i][1] + SKY_WIDTH - offset) % SKY_WIDTH) - 16;
+}
+
+// Clear a 16-row area of the selected layer, clipped at the screen edges
+static void clearArea(unsigned char row, int col, unsigned char width) {
+    int last = col + width * 8 - 1;
+    if (last < 0 || col >= 128) return;
+    if (col < 0) col = 0;
+    LCD_SetArea(col, row, last, row + 15, 0);
+}
+
+// Draw sky decorations on the background layer, scrolling slower than the ground
+void drawSky(DinoGameState *state) {
+    unsigned int offset = skyOffset(state->scrollPos);
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    for (unsigned char i = 0; i < SKY_DECORATIONS; i++) {
+        LCD_BlitSprite(skyColumn(offset, i), skyDecorations[i][0] * 8,
+                       (LCD_SpriteIdTypeDef)skyDecorations[i][2], 0, LCD_BLIT_OR);
+    }
+}
+
+// Move sky decorations after the scroll position advanced from prevScrollPos
+// Nothing is drawn while the parallax offset stays on the same pixel
+void moveSky(DinoGameState *state, unsigned int prevScrollPos) {
+    unsigned int prevOffset = skyOffset(prevScrollPos);
+    if (prevOffset == skyOffset(state->scrollPos)) return;
+    
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    for (unsigned char i = 0; i < SKY_DECORATIONS; i++) {
+        clearArea(skyDecorations[i][0] * 8, skyColumn(prevOffset, i), 2);
+    }
+    drawSky(state);
+}
+
+// Draw ground line (full width) - static, no scrolling
+void drawGroundLine(unsigned char page) {
+    // Draw a continuous line across the entire width at GROUND_PAGE
+    // using the plain ground tile
+    const unsigned char *sprite = LCD_SpriteFrame(SPRITE_GROUND_LINE, GROUND_PLAIN);
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    for (unsigned char i = 0; i < 16; i++) {  // 128 pixels / 8 = 16 sprites
+        LCD_DrawString(page, i * 8, sprite, 1);
+    }
+}
+
+// Advance the scroll position by the current sub-pixel speed
+// Returns the number of whole pixels the playfield moved this frame
+unsigned char updateScroll(DinoGameState *state) {
+    unsigned int oldPixels = state->scrollPos >> SCROLL_FIXED_SHIFT;
+    state->scrollPos += state->scrollSpeed;
+    return (state->scrollPos >> SCROLL_FIXED_SHIFT) - oldPixels;
+}
+
+// Draw the scrolling ground line across the full width of the background
+// The ground pattern moves one pixel per scrolled pixel: the row starts
+// with a partly visible tile left of the screen and is clipped by the blitter.
+// Sprites on the playfield layer are composited over it
+void drawScrollingGround(unsigned char page, DinoGameState *dino) {
+    unsigned char row[17];
+    unsigned int offset = (dino->scrollPos >> SCROLL_FIXED_SHIFT) % (GROUND_PATTERN_LENGTH * 8);
+    for (unsigned char i = 0; i < 17; i++) {
+        row[i] = *LCD_SpriteFrame(SPRITE_GROUND_LINE, groundPattern[(i + offset / 8) % GROUND_PATTERN_LENGTH]);
+    }
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    LCD_BlitString(-(int)(offset % 8), page * 8, row, 17, LCD_BLIT_COPY);
+}
+
+// Animate ground line entry from right to left (blocking animation for start screen)
+// This creates a cool starting effect where the ground "rolls in" from the right
+// The dino runs in place while waiting for the ground to arrive
+void animateGroundLineEntry(unsigned char page, DinoGameState *dino) {
+    const unsigned char *sprite = LCD_SpriteFrame(SPRITE_GROUND_LINE, GROUND_PLAIN);
+    
+    // Draw dino first before ground animation starts
+    drawDino(dino);
+    
+    // Start from rightmost position and draw progressively to the left
+    // Each step adds one more 8-pixel block from the right
+    for (int col = 15; col >= 0; col--) {
+        // Update dino animation frame
+        updateDinoAnimation(dino);
+        
+        // Draw ground line from current column to the right edge,
+        // then the dino on top of it with updated animation
+        clearSpriteAt(dino->dinoRow, dino->dinoY, 2);
+        LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+        for (int i = col; i < 16; i++) {
+            LCD_DrawString(page, i * 8, sprite, 1);
+        }
+        drawDino(dino);
+        LCD_Flush();
+        HAL_Delay(30);  // Animation delay between frames
+    }
+}
+
+// Clear a sprite area of the playfield by drawing blank characters
+void clearSprite(unsigned char x, unsigned char y, unsigned char width) {
+    unsigned char blank[1] = {DSpace};
+    LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+    for (unsigned char i = 0; i < width; i++) {
+        LCD_DrawString(x, y + (i * 8), blank, 1);
+    }
+}
+
+// Clear a sprite area of the playfield at a pixel row (for sprites drawn
+// with LCD_BlitString), the background underneath shows through again
+// The column may be negative for sprites leaving the screen on the left
+void clearSpriteAt(unsigned char row, int col, unsigned char width) {
+    LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+    clearArea(row, col, width);
+}
+
+// Draw score at page x, column y in the 8x16 font
+void drawScore(uint32_t score, unsigned char x, unsigned char y) {
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    LCD_Printf(x, y, "%lu", (unsigned long)score);
+}
+
+// Draw right-aligned text into a HUD field on HUD_PAGE of the background
+// The field is cleared and drawn in one dirty run, so an update goes out as
+// a single partial-page write of the columns that changed
+static void drawHudField(unsigned char col, unsigned char width, const char *text) {
+    unsigned int textWidth = LCD_SmallTextWidth(text);
+    if (textWidth > width) textWidth = width;
+    
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    LCD_SetArea(col, HUD_PAGE * 8, col + width - 1, HUD_PAGE * 8 + 7, 0);
+    LCD_DrawSmallText(HUD_PAGE, col + width - textWidth, text);
+}
+
+// Score widget: a zero-padded HUD number that remembers the digits it drew
+// last, so a new value only redraws the digit cells that changed
+typedef struct {
+    unsigned char col;                  // column of the first digit
+    char digits[HUD_SCORE_DIGITS];      // digits on screen, 0 = not drawn
+} ScoreWidget;
+
+static ScoreWidget scoreWidget = {HUD_SCORE_COL, {0}};
+static ScoreWidget hiScoreWidget = {HUD_HISCORE_COL + HUD_HISCORE_LABEL, {0}};
+
+// Draw a value into a score widget, capped at HUD_SCORE_MAX
+// Every digit is one glyph that replaces the page bytes under it, so no
+// clearing is needed; a +1 usually changes the last digit only
+static void drawScoreWidget(ScoreWidget *widget, uint32_t value) {
+    char text[HUD_SCORE_DIGITS];
+    char digit[2] = {0, 0};
+    
+    if (value > HUD_SCORE_MAX) value = HUD_SCORE_MAX;
+    for (int i = HUD_SCORE_DIGITS - 1; i >= 0; i--) {
+        text[i] = '0' + value % 10;
+        value /= 10;
+    }
+    
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    for (unsigned char i = 0; i < HUD_SCORE_DIGITS; i++) {
+        if (text[i] != widget->digits[i]) {
+            digit[0] = text[i];
+            LCD_DrawSmallText(HUD_PAGE, widget->col + i * HUD_DIGIT_PITCH, digit);
+            widget->digits[i] = text[i];
+        }
+    }
+}
+
+// Draw game score in upper right corner of LCD
+void drawGameScore(uint32_t score) {
+    drawScoreWidget(&scoreWidget, score);
+}
+
+// Draw the high score left of the score
+void drawHighScore(uint32_t hiScore) {
+    drawScoreWidget(&hiScoreWidget, hiScore);
+}
+
+// Draw the speed level, 1 at SCROLL_SPEED_INIT and one more per speed increase
+void drawSpeedLevel(DinoGameState *state) {
+    char text[8];
+    
+    LCD_Sprintf(text, sizeof(text), "SPD %u",
+                (state->scrollSpeed - SCROLL_SPEED_INIT) / SCROLL_SPEED_STEP + 1);
+    drawHudField(HUD_SPEED_COL, HUD_SPEED_WIDTH, text);
+}
+
+// Draw the lives left (also shown on the LEDs)
+void drawLives(unsigned char lives) {
+    char text[8];
+    
+    LCD_Sprintf(text, sizeof(text), "LIFE %u", lives);
+    drawHudField(HUD_LIVES_COL, HUD_LIVES_WIDTH, text);
+}
+
+// Draw the whole HUD: lives, speed level, high score and score on HUD_PAGE
+// The screen was cleared before, so the score widgets draw every digit again
+void drawHud(DinoGameState *state, uint32_t hiScore) {
+    memset(scoreWidget.digits, 0, sizeof(scoreWidget.digits));
+    memset(hiScoreWidget.digits, 0, sizeof(hiScoreWidget.digits));
+    
+    drawLives(state->lives);
+    drawSpeedLevel(state);
+    LCD_TileSet(HUD_PAGE, HUD_HISCORE_COL / 8, LCD_TILE(HUD_HI, 0));  // static label, kept on the tile map
+    drawHighScore(hiScore);
+    drawGameScore(state->score);
+}
+
+// Draw "START" text in the middle of the LCD
+void drawStartScreen(void) {
+    // Middle page is 3 or 4 (LCD has pages 0-7)
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    LCD_DrawText(3, LCD_TEXT_CENTER, "START");
+}
+
+// Draw "GAME OVER" text in the middle of the LCD
+void drawEndScreen(void) {
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    LCD_DrawText(3, LCD_TEXT_CENTER, "GAME OVER");  // centered on single line
+}
+
+// Update LEDs to show number of lives (1-4)
+void updateLivesLED(unsigned char lives) {
+    // LED1 = life 1, LED2 = life 2, etc.
+    // Turn ON LEDs for each life, OFF for the rest
+    HAL_GPIO_WritePin(LED4_GPIO_PORT, LED4_PIN, (lives >= 1) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(LED3_GPIO_PORT, LED3_PIN, (lives >= 2) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(LED2_GPIO_PORT, LED2_PIN, (lives >= 3) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(LED1_GPIO_PORT, LED1_PIN, (lives >= 4) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+}
+
+// Start the hit feedback after losing a life: the screen is inverted for
+// HIT_FLASH_FRAMES, drawDino() shows the hit sprite and then blinks, and
+// collisions are ignored while hitTimer runs
+void startHitEffect(DinoGameState *state) {
+    state->hitTimer = HIT_INVULNERABLE_FRAMES;
+    state->flashTimer = HIT_FLASH_FRAMES;
+    LCD_SetReverse(1);
+}
+
+// Count the hit effect down, call once per frame before the frame is shown
+// The display goes back to normal with the frame the flash ends on
+void updateHitEffect(DinoGameState *state) {
+    if (state->hitTimer) {
+        state->hitTimer--;
+    }
+    if (state->flashTimer && --state->flashTimer == 0) {
+        LCD_SetReverse(0);
+    }
+}
+
+// Update game speed - gradually increases pace over time
+// scrollSpeed is the sub-pixel distance the playfield moves every frame
+// This function should be called every frame
+void updateGameSpeed(DinoGameState *state) {
+    state->speedTimer++;
+    
+    // Check if it's time to increase speed
+    if (state->speedTimer >= SPEED_INCREASE_RATE) {
+        state->speedTimer = 0;
+        
+        // Increase scroll speed in small steps up to the maximum
+        if (state->scrollSpeed + SCROLL_SPEED_STEP <= SCROLL_SPEED_MAX) {
+            state->scrollSpeed += SCROLL_SPEED_STEP;
+        }
+    }
 }
\ No newline at end of file
@@ -1,1698 +1,2659 @@
-#include "lcd.h"
-
-unsigned char ChineseTable[][16] = {
-	//0x83,0x83,0x83,0xff,0xff,0x83,0x83,0x83,0xc1,0xc1,0xc1,0xff,0xff,0xc1,0xc1,0xc1,
-/*--  ??:  0  --0*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x0F,0x10,0x20,0x20,0x10,0x0F,0x00,
-
-/*--  ??:  1  --1*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x10,0x10,0xF8,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00,
-
-/*--  ??:  2  --2*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x70,0x08,0x08,0x08,0x88,0x70,0x00,0x00,0x30,0x28,0x24,0x22,0x21,0x30,0x00,
-
-/*--  ??:  3  --3*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x30,0x08,0x88,0x88,0x48,0x30,0x00,0x00,0x18,0x20,0x20,0x20,0x11,0x0E,0x00,
-
-/*--  ??:  4  --4*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0xC0,0x20,0x10,0xF8,0x00,0x00,0x00,0x07,0x04,0x24,0x24,0x3F,0x24,0x00,
-
-/*--  ??:  5  --5*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0xF8,0x08,0x88,0x88,0x08,0x08,0x00,0x00,0x19,0x21,0x20,0x20,0x11,0x0E,0x00,
-
-/*--  ??:  6  --6*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0xE0,0x10,0x88,0x88,0x18,0x00,0x00,0x00,0x0F,0x11,0x20,0x20,0x11,0x0E,0x00,
-
-/*--  ??:  7  --7*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x38,0x08,0x08,0xC8,0x38,0x08,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
-
-/*--  ??:  8  --8*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x70,0x88,0x08,0x08,0x88,0x70,0x00,0x00,0x1C,0x22,0x21,0x21,0x22,0x1C,0x00,
-
-/*--  ??:  9  --9*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x00,0x31,0x22,0x22,0x11,0x0F,0x00,
-
-/*--  ??:  .  --10*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x00,
-
-/*--  ??:  k  --11*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x00,0x00,0x80,0x80,0x80,0x00,0x20,0x3F,0x24,0x02,0x2D,0x30,0x20,0x00,
-
-/*--  ??:  W  --12*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0xF8,0x08,0x00,0xF8,0x00,0x08,0xF8,0x00,0x03,0x3C,0x07,0x00,0x07,0x3C,0x03,0x00,
-
-/*--  ??:  h  --13*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20,
-
-/*--  ??:  v  --14*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x01,0x0E,0x30,0x08,0x06,0x01,0x00,
-
-/*--  ??:  a  --15*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x19,0x24,0x22,0x22,0x22,0x3F,0x20,
-
-/*--  ??:  r  --16*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x20,0x20,0x3F,0x21,0x20,0x00,0x01,0x00,
-
-/*--  ??:  V  --17*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0x78,0x88,0x00,0x00,0xC8,0x38,0x08,0x00,0x00,0x07,0x38,0x0E,0x01,0x00,0x00,
-
-/*--  ??:  A  --18*/
-/*--  ??12;  ??????????:?x?=8x16   --18*/
-0x00,0x00,0xC0,0x38,0xE0,0x00,0x00,0x00,0x20,0x3C,0x23,0x02,0x02,0x27,0x38,0x20,
-
-/*--  ??:  B  --19*/
-/*--  ??12;  ??????????:?x?=8x16   --19*/
-0x08,0xF8,0x88,0x88,0x88,0x70,0x00,0x00,0x20,0x3F,0x20,0x20,0x20,0x11,0x0E,0x00,
-
-/*--  ??:  -  --20*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-
-/*--  ??:  :  --21*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,
-
-/*--  ??:  "??? "  --22~29*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-//Display English letter
-/*--  ??:  a  --30*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x19,0x24,0x22,0x22,0x22,0x3F,0x20,
-
-/*--  ??:  b  --31*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x00,0x80,0x80,0x00,0x00,0x00,0x00,0x3F,0x11,0x20,0x20,0x11,0x0E,0x00,
-
-/*--  ??:  c  --32*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x0E,0x11,0x20,0x20,0x20,0x11,0x00,
-
-/*--  ??:  d  --33*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x00,0x80,0x80,0x88,0xF8,0x00,0x00,0x0E,0x11,0x20,0x20,0x10,0x3F,0x20,
-
-/*--  ??:  e  --34*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x1F,0x22,0x22,0x22,0x22,0x13,0x00,
-
-/*--  ??:  f  --35*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x80,0x80,0xF0,0x88,0x88,0x88,0x18,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00,
-
-/*--  ??:  g  --36*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x6B,0x94,0x94,0x94,0x93,0x60,0x00,
-
-/*--  ??:  h  --37*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20,
-
-/*--  ??:  i  --38*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x80,0x98,0x98,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00,
-
-/*--  ??:  j  --39*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x00,0x80,0x98,0x98,0x00,0x00,0x00,0xC0,0x80,0x80,0x80,0x7F,0x00,0x00,
-
-/*--  ??:  k  --40*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x00,0x00,0x80,0x80,0x80,0x00,0x20,0x3F,0x24,0x02,0x2D,0x30,0x20,0x00,
-
-/*--  ??:  l  --41*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x08,0x08,0xF8,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00,
-
-/*--  ??:  m  --42*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x20,0x3F,0x20,0x00,0x3F,0x20,0x00,0x3F,
-
-/*--  ??:  n  --43*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20,
-
-/*--  ??:  o  --44*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x1F,0x20,0x20,0x20,0x20,0x1F,0x00,
-
-/*--  ??:  p  --45*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x00,0x80,0x80,0x00,0x00,0x00,0x80,0xFF,0xA1,0x20,0x20,0x11,0x0E,0x00,
-
-/*--  ??:  q  --46*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x0E,0x11,0x20,0x20,0xA0,0xFF,0x80,
-
-/*--  ??:  r  --47*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x20,0x20,0x3F,0x21,0x20,0x00,0x01,0x00,
-
-/*--  ??:  s  --48*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x33,0x24,0x24,0x24,0x24,0x19,0x00,
-
-/*--  ??:  t  --49*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x80,0x80,0xE0,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x1F,0x20,0x20,0x00,0x00,
-
-/*--  ??:  u  --50*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x1F,0x20,0x20,0x20,0x10,0x3F,0x20,
-
-/*--  ??:  v  --51*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x01,0x0E,0x30,0x08,0x06,0x01,0x00,
-
-/*--  ??:  w  --52*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x00,0x80,0x00,0x80,0x80,0x80,0x0F,0x30,0x0C,0x03,0x0C,0x30,0x0F,0x00,
-
-/*--  ??:  x  --53*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x31,0x2E,0x0E,0x31,0x20,0x00,
-
-/*--  ??:  y  --54*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x80,0x81,0x8E,0x70,0x18,0x06,0x01,0x00,
-
-/*--  ??:  z  --55*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x21,0x30,0x2C,0x22,0x21,0x30,0x00,
-
-/*--  ??:  A  --56*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0xC0,0x38,0xE0,0x00,0x00,0x00,0x20,0x3C,0x23,0x02,0x02,0x27,0x38,0x20,
-
-/*--  ??:  B  --57*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x88,0x88,0x88,0x70,0x00,0x00,0x20,0x3F,0x20,0x20,0x20,0x11,0x0E,0x00,
-
-/*--  ??:  C  --58*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0xC0,0x30,0x08,0x08,0x08,0x08,0x38,0x00,0x07,0x18,0x20,0x20,0x20,0x10,0x08,0x00,
-
-/*--  ??:  D  --59*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x08,0x08,0x08,0x10,0xE0,0x00,0x20,0x3F,0x20,0x20,0x20,0x10,0x0F,0x00,
-
-/*--  ??:  E  --60*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x88,0x88,0xE8,0x08,0x10,0x00,0x20,0x3F,0x20,0x20,0x23,0x20,0x18,0x00,
-
-/*--  ??:  F  --61*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x88,0x88,0xE8,0x08,0x10,0x00,0x20,0x3F,0x20,0x00,0x03,0x00,0x00,0x00,
-
-/*--  ??:  G  --62*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0xC0,0x30,0x08,0x08,0x08,0x38,0x00,0x00,0x07,0x18,0x20,0x20,0x22,0x1E,0x02,0x00,
-
-/*--  ??:  H  --63*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x08,0x00,0x00,0x08,0xF8,0x08,0x20,0x3F,0x21,0x01,0x01,0x21,0x3F,0x20,
-
-/*--  ??:  I  --64*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x08,0x08,0xF8,0x08,0x08,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00,
-
-/*--  ??:  J  --65*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x00,0x08,0x08,0xF8,0x08,0x08,0x00,0xC0,0x80,0x80,0x80,0x7F,0x00,0x00,0x00,
-
-/*--  ??:  K  --66*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x88,0xC0,0x28,0x18,0x08,0x00,0x20,0x3F,0x20,0x01,0x26,0x38,0x20,0x00,
-
-/*--  ??:  L  --67*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x08,0x00,0x00,0x00,0x00,0x00,0x20,0x3F,0x20,0x20,0x20,0x20,0x30,0x00,
-
-/*--  ??:  M  --68*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0xF8,0x00,0xF8,0xF8,0x08,0x00,0x20,0x3F,0x00,0x3F,0x00,0x3F,0x20,0x00,
-
-/*--  ??:  N  --69*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x30,0xC0,0x00,0x08,0xF8,0x08,0x20,0x3F,0x20,0x00,0x07,0x18,0x3F,0x00,
-
-/*--  ??:  O  --70*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0xE0,0x10,0x08,0x08,0x08,0x10,0xE0,0x00,0x0F,0x10,0x20,0x20,0x20,0x10,0x0F,0x00,
-
-/*--  ??:  P  --71*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x08,0x08,0x08,0x08,0xF0,0x00,0x20,0x3F,0x21,0x01,0x01,0x01,0x00,0x00,
-
-/*--  ??:  Q  --72*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0xE0,0x10,0x08,0x08,0x08,0x10,0xE0,0x00,0x0F,0x18,0x24,0x24,0x38,0x50,0x4F,0x00,
-
-/*--  ??:  R  --73*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x88,0x88,0x88,0x88,0x70,0x00,0x20,0x3F,0x20,0x00,0x03,0x0C,0x30,0x20,
-
-/*--  ??:  S  --74*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x00,0x70,0x88,0x08,0x08,0x08,0x38,0x00,0x00,0x38,0x20,0x21,0x21,0x22,0x1C,0x00,
-
-/*--  ??:  T  --75*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x18,0x08,0x08,0xF8,0x08,0x08,0x18,0x00,0x00,0x00,0x20,0x3F,0x20,0x00,0x00,0x00,
-
-/*--  ??:  U  --76*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0xF8,0x08,0x00,0x00,0x08,0xF8,0x08,0x00,0x1F,0x20,0x20,0x20,0x20,0x1F,0x00,
-
-/*--  ??:  V  --77*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0x78,0x88,0x00,0x00,0xC8,0x38,0x08,0x00,0x00,0x07,0x38,0x0E,0x01,0x00,0x00,
-
-/*--  ??:  W  --78*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0xF8,0x08,0x00,0xF8,0x00,0x08,0xF8,0x00,0x03,0x3C,0x07,0x00,0x07,0x3C,0x03,0x00,
-
-/*--  ??:  X  --79*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0x18,0x68,0x80,0x80,0x68,0x18,0x08,0x20,0x30,0x2C,0x03,0x03,0x2C,0x30,0x20,
-
-/*--  ??:  Y  --80*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x08,0x38,0xC8,0x00,0xC8,0x38,0x08,0x00,0x00,0x00,0x20,0x3F,0x20,0x00,0x00,0x00,
-
-/*--  ??:  Z  --81*/
-/*--  ??12;  ??????????:?x?=8x16   --*/
-0x10,0x08,0x08,0x08,0xC8,0x38,0x08,0x00,0x20,0x38,0x26,0x21,0x20,0x20,0x18,0x00,
-
-/*--  ??:  "??? "  --82 ~ 99*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-/*--  ??:  "??? "  --100*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-//display graph
-/*--  ??:  ???  --110*/
-/*--  ??12;  ??????????:?x?=16x16   --*/
-0x00,0xE0,0x20,0x20,0x20,0x3C,0x04,0x04,0x00,0x03,0x02,0x02,0x02,0x1E,0x10,0x10,
-0x04,0x04,0x04,0x04,0x04,0x04,0x04,0xFC,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,
-
-/*--  ??:  ???  --112*/
-/*--  ??12;  ??????????:?x?=16x16   --*/
-0xFC,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x1F,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
-0x04,0x04,0x04,0x04,0x04,0xFC,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x1F,0x00,0x00,
-
-/*--  ??:  ????1  --114*/
-/*--  ??12;  ??????????:?x?=16x16   --*/
-0x00,0x00,0x80,0x80,0x80,0xF0,0x10,0x10,0x00,0x00,0x0F,0x08,0x08,0x08,0x08,0x08,
-0x10,0xF0,0x80,0x80,0x80,0x80,0x80,0x80,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
-
-/*--  ??:  ????2  --116*/
-/*--  ??12;  ??????????:?x?=16x16   --*/
-0x80,0x80,0x80,0x80,0x80,0x80,0xE0,0x30,0x08,0x08,0x08,0x08,0x08,0x08,0x38,0x60,
-0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0x00,0x40,0x4F,0x49,0x49,0x4F,0x40,0x7F,0x00,
-
-/*--  ??:  ??1  --118*/
-/*--  ??12;  ??????????:?x?=16x16   --*/
-0x00,0x00,0x00,0x00,0x00,0x7E,0x81,0x02,0x00,0x00,0x00,0x08,0x10,0x30,0x49,0x06,
-0x04,0x08,0x10,0x20,0x40,0x80,0x00,0x00,0x04,0x08,0x10,0x20,0x20,0x20,0x21,0x22,
-
-/*--  CACTUS_BIG  --120*/
-/*--  Large Cactus - 16x16 pixels   --*/
-0xC0,0xC0,0xFE,0xFE,0x60,0x38,0x80,0x00,0x07,0x07,0xFF,0xFF,0x00,0x0E,0xFF,0x18,
-0x78,0xFC,0x80,0xFF,0xFF,0x00,0xF0,0xF0,0x0E,0x00,0x01,0xFF,0xFF,0x06,0x03,0x01,
-
-/*--  CACTUS_SMALL  --122*/
-/*--  Small Cactus - 8x16 pixels   --*/
-0x70,0x80,0x80,0xFF,0x00,0x00,0xF8,0xF8,0x00,0x00,0x00,0xFF,0x06,0x04,0x03,0x01,
-
-/*--  STAR  --123*/
-/*--  Star decoration - 16x16 pixels   --*/
-0x00,0x00,0x40,0x40,0xC0,0x40,0x40,0x38,0x00,0x00,0x00,0x00,0x20,0x1F,0x10,0x08,
-0x06,0x38,0x40,0x40,0xC0,0x40,0x40,0x00,0x04,0x08,0x10,0x1F,0x20,0x00,0x00,0x00,
-
-/*--  DINO_STAND  --125*/
-/*--  Dino Standing/Jumping - 16x16 pixels   --*/
-0x00,0xE0,0x80,0x00,0x00,0x80,0xC0,0xFE,0x00,0x03,0x07,0x0F,0xFF,0xBF,0x3F,0x3F,
-0xFF,0xFB,0xFF,0xFF,0x2F,0x2F,0x0E,0x00,0xFF,0x8F,0x07,0x01,0x01,0x03,0x00,0x00,
-
-/*--  DINO_RUN  --127*/
-/*--  Dino Running Frame 1 - 16x16 pixels   --*/
-0x00,0xF8,0xC0,0x00,0x00,0x80,0xC0,0xFE,0x00,0x03,0x07,0x0F,0x7F,0x5F,0x1F,0x1F,
-0xFF,0xFB,0xFF,0xFF,0x2F,0x2F,0x0E,0x00,0xFF,0x9F,0x07,0x01,0x01,0x03,0x00,0x00,
-
-/*--  DINO_RUN_2  --129*/
-/*--  Dino Running Frame 2 - 16x16 pixels   --*/
-0x00,0xF8,0xC0,0x00,0x00,0x80,0xC0,0xFE,0x00,0x03,0x07,0x0F,0xFF,0x9F,0x1F,0x1F,
-0xFF,0xFB,0xFF,0xFF,0x2F,0x2F,0x0E,0x00,0x7F,0x5F,0x07,0x01,0x01,0x03,0x00,0x00,
-
-/*--  DINO_DEAD  --131*/
-/*--  Dino Dead sprite - 16x16 pixels   --*/
-0x80,0x00,0x00,0x00,0x00,0x02,0x0E,0x02,0xFF,0xF8,0xF0,0xE0,0xE0,0xE0,0xF0,0xF0,
-0x08,0x06,0x08,0x02,0x0E,0x02,0x00,0x00,0xF8,0x8C,0xAC,0x8C,0xFC,0xBC,0xBC,0x38,
-
-/*--  MOON  --133*/
-/*--  Moon decoration - 16x16 pixels   --*/
-0xE0,0x10,0x0C,0x04,0x02,0xC1,0x31,0x09,0x07,0x08,0x30,0x20,0x40,0x83,0x8C,0x90,
-0x05,0x05,0x03,0x02,0x00,0x00,0x00,0x00,0xA0,0xA0,0xC0,0x00,0x00,0x00,0x00,0x00,
-
-/*--  BIRD_FLY  --135*/
-/*--  Flying bird - 16x16 pixels   --*/
-0x00,0x00,0x00,0x80,0xC0,0x80,0x00,0xF8,0x00,0x02,0x03,0x03,0x03,0x07,0x07,0x07,
-0xE0,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x06,0x06,0x02,0x00,
-
-/*--  BIRD_FLY_2--137*/
-/*--  Flying bird - 16x16 pixels   --*/
-0x00,0x00,0x00,0x80,0xC0,0x80,0x00,0x00,0x00,0x02,0x03,0x03,0x03,0x07,0x07,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x1F,0x0F,0x07,0x06,0x06,0x02,0x00,
-
-/*--  DINO_HIT--139*/
-/*--  Dino Hit sprite - 16x16 pixels   --*/
-0x00,0xE0,0x80,0x00,0x00,0x80,0xC0,0xFE,0x00,0x03,0x07,0x0F,0xFF,0xBF,0x3F,0x3F,
-0xF1,0xF5,0xF1,0xFF,0x2F,0x2F,0x0E,0x00,0xFF,0x8F,0x07,0x01,0x01,0x03,0x00,0x00,
-
-/*--  DINO_CROUCH_1--141*/
-/*--  Dino Crouch Frame 1 - 16x16 pixels   --*/
-0xFC,0xE0,0xC0,0x80,0x80,0x80,0x80,0x80,0x07,0x0F,0x1F,0x7F,0x5F,0x1F,0x1F,0xFF,
-0xC0,0xE0,0x60,0xE0,0xE0,0xE0,0xE0,0xC0,0x8F,0x3F,0x2F,0x0F,0x0F,0x0B,0x0B,0x03,
-
-/*--  DINO_CROUCH_2--143*/
-/*--  Dino Crouch Frame 2 - 16x16 pixels   --*/
-0xFC,0xE0,0xC0,0x80,0x80,0x80,0x80,0x80,0x07,0x0F,0x1F,0xFF,0x9F,0x1F,0x1F,0x7F,
-0xC0,0xE0,0x60,0xE0,0xE0,0xE0,0xE0,0xC0,0x4F,0x3F,0x2F,0x0F,0x0F,0x0B,0x0B,0x03,
-
-/*--  GROUND_LINE_1 --145*/
-/*--  Ground line 1 - 8x16 pixels   --*/
-0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-/*--  GROUND_LINE_2  --146*/
-/*--  Ground line 2- 8x16 pixels   --*/
-0x08,0x28,0x28,0x08,0x08,0x08,0xE8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-/*--  GROUND_LINE_3  --147*/
-/*--  Ground line 3- 8x16 pixels   --*/
-0x08,0x08,0x10,0x10,0x10,0x10,0x10,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-/*--  GROUND_LINE_4  --148*/
-/*--  Ground line 4- 8x16 pixels   --*/
-0x08,0x28,0x28,0x08,0x48,0x08,0x28,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-/*--  CLOUD  --149*/
-/*--  Cloud- 16x16 pixels   --*/
-0x00,0x00,0x80,0x40,0x40,0x20,0x10,0x10,0x00,0x03,0x04,0x08,0x08,0x08,0x08,0x10,
-0x10,0x10,0x20,0x20,0x40,0x80,0x00,0x00,0x10,0x10,0x08,0x08,0x08,0x04,0x03,0x00,
-
-};
-
-
-unsigned char DispSTLoGoTable[] = {
-  /*page 0*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xE0,0xF0,0xF8,0xF8,0xFC,0xFC,0xFC,0xFC,
-0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
-0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
-0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
-0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
-0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
-0xFC,0xFC,0x7C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-/*page 1*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xF8,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,
-0x7F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,
-0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,
-0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0xBF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x3F,0x3F,0x3F,0x3F,0x3F,
-0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,
-0x0F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-/*page 2*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x07,0x1F,0x3F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-0xFC,0xF8,0xF0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x1F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-/*page 3*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x07,0x0F,0x1F,0x3F,0x7F,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFC,0xF8,0xF0,0xE0,0xC0,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x80,0xF0,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x7F,0x3F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-/*page 4*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0x03,0x07,0x0F,0x1F,0x3F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-0xFC,0xF8,0xF0,0xE0,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xC0,0xF8,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,
-0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-/*page 5*/
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x07,0x0F,0x3F,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF8,0x00,0x00,0x00,0x00,0x00,0x80,0xF0,
-0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x07,0x03,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-/*page 6*/
-0x00,0x00,0x80,0xE0,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,
-0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,
-0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x07,0x01,0x00,0x80,0xC0,0xF8,0xFC,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-/*page 7*/
-0x40,0x78,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x3F,0x1F,0x0F,0x07,0x03,0x00,0x00,0x40,0x60,0x7C,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
-0x7F,0x7F,0x7F,0x7F,0x1F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-/*******************************************************************************/
-void Converse_Logo(void)
-{
-	int i=64*16;
-	unsigned char *p=DispSTLoGoTable;
-	while (i--)
-	{
-		*p = ~(*p);
-		p++;
-	}
-}
-/*******************************************************************************
-* Function Name  : LCD_Draw_ST_Logo
-* Description    : draw a ST logo
-* Input          : None
-* Output         : None
-* Return         : 0 -- failure
-                   1 -- success
-*******************************************************************************/
-void LCD_Draw_ST_Logo()
-{
-  
-  unsigned char i,j;
-  unsigned char *p=DispSTLoGoTable;
-  
-  LCD_Command = COM_Scan_Dir_Reverse;
-  
-  LCD_Command = Set_Start_Line_X|0x0;
-  delay();
-  
-  for (i=0; i<8; i++)
-  {
-    // for each page 
-    LCD_Command = Set_Page_Addr_X|i; // page no.
-    delay();
-    LCD_Command = Set_ColH_Addr_X|0x0; // fixed col first addr
-    delay();
-    LCD_Command = Set_ColL_Addr_X|0x0;
-    delay();
-    
-    j=128;
-    while (j--)
-    {
-      LCD_Data=*p++;
-      delay();
-    }
-  }
-
-}
-/*******************************************************************************
-* Function Name  : LCD_DrawChar
-* Description    : draw an char at certain postion
-* Input          : Xpage -- postion of page
-                   YCol -- postion of colomn
-                   offset -- font offset in the ChineseTable[]
-* Output         : None
-* Return         : 0 -- failure
-                   1 -- success
-*******************************************************************************/
-void LCD_DrawChar(unsigned char Xpage, unsigned char YCol, unsigned char offset)
-{  
-  int i=8;
-  unsigned char coll = YCol & 0x0f;
-  unsigned char colh = YCol >> 4;
-  unsigned char *c = ChineseTable[0]+16*offset;
-  
-  LCD_Command = Set_Start_Line_X|0x0;   delay();
-  LCD_Command = Set_Page_Addr_X|Xpage;  delay();
-  LCD_Command = Set_ColH_Addr_X|colh;   delay();
-  LCD_Command = Set_ColL_Addr_X|coll;   delay();
-  while (i--)
-  {
-    LCD_Data=*c++;
-    delay();
-  }
-  i=8;
-  LCD_Command = Set_Page_Addr_X|(Xpage+1);  delay();
-  LCD_Command = Set_ColH_Addr_X|colh;       delay();
-  LCD_Command = Set_ColL_Addr_X|coll;       delay();
-  while(i--)
-  {
-    LCD_Data=*c++;
-    delay();
-  }
-}
-/*******************************************************************************
-* Function Name  : LCD_DrawString
-* Description    : draw a string of length at certain postion
-* Input          : Xpage -- postion of page
-                   YCol -- postion of colomn
-                   c -- pointer to the string to be displayed
-                   length -- length of string
-* Output         : None
-* Return         : 0 -- failure
-                   1 -- success
-*******************************************************************************/
-unsigned char LCD_DrawString(unsigned char Xpage, unsigned char YCol, unsigned char *c, unsigned char length)
-{
-unsigned char len = length;
-unsigned char* pOffset = c;
-
-  if ((128-YCol)<8*length)
-    return 0;
-  else
-  {
-    while(len--)
-    {
-      LCD_DrawChar(Xpage, YCol, *pOffset);
-      YCol +=8;
-      pOffset++;
-    }
-    return 1;
-  }
-}
-void delay(void)
-{
-  volatile unsigned char i=0x8;
-  while(i--)
-	{
-		//asm("NOP");
-	}
-
-}
-
-  
-
-void reset_delay(void)
-{
-  volatile unsigned long i=0xff;
-  while(i--);
-}
-
-
-void power_delay(void)
-{
-  volatile unsigned long i=0x4ffff;
-  while(i--);
-}
-
-
-/*******************************************************************************
-* Function Name  : STM3210E_LCD_Init
-* Description    : Initializes the LCD.
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void STM3210E_LCD_Init(void)
-{  
-/* Configure the LCD Control pins --------------------------------------------*/
-  LCD_CtrlLinesConfig();
-
-/* Configure the FSMC Parallel interface -------------------------------------*/
-  LCD_FSMCConfig();
-  
-
-  LCD_Command = Display_Off; //
-  delay();
-  LCD_Command = LCD_Reset; //
-  reset_delay();
-  
-  LCD_Command = Set_LCD_Bias_9;
-  delay();
-  LCD_Command = Set_ADC_Normal;
-  delay();
-  LCD_Command = COM_Scan_Dir_Reverse;
-  delay();
-  LCD_Command = Set_Start_Line_X|0x0;
-  delay();
-  
-  LCD_Command = 0x2c;
-  power_delay(); // 50ms requried
-  LCD_Command = 0x2e;
-  power_delay(); // 50ms
-  LCD_Command = 0x2f;
-  power_delay(); // 50ms
-  
-  LCD_Command = Set_Ref_Vol_Reg|0x05;
-  delay();
-  LCD_Command = Set_Ref_Vol_Mode;
-  delay();
-  LCD_Command = Set_Ref_Vol_Reg;
-  delay();
-  
-  LCD_Clear();
-  delay();
-  
-  LCD_Command = Set_Page_Addr_X|0x0;
-  delay();
-  LCD_Command = Set_ColH_Addr_X|0x0;
-  delay();
-  LCD_Command = Set_ColL_Addr_X|0x0;
-  delay();
- 
-  LCD_Command = Display_On; //
-  delay();
-}
-
-
-/*******************************************************************************
-* Function Name  : LCD_Clear
-* Description    : Clears the hole LCD.
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void LCD_Clear(void)
-{
-  
-  unsigned char i,j=128;
-  unsigned char data=0x0;
-  
-  LCD_Command = Set_Start_Line_X|0x0; // start line
-    delay();
-    
-  for (i=0; i<8; i++)
-  {
-    // for each page 
-    LCD_Command = Set_Page_Addr_X|i; // page no.
-    delay();
-    LCD_Command = Set_ColH_Addr_X|0x0; // fixed col first addr
-    delay();
-    LCD_Command = Set_ColL_Addr_X|0x0;
-    delay();
-    
-    while (j--)
-    {
-      LCD_Data=data;
-      delay();
-    }
-  }
-}
-
-/*******************************************************************************
-* Function Name  : LCD_Reset_Cursor
-* Description    : set the cursor at the middle of LCD --> at page 3&4 column (64-8)~(64+8)
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void LCD_Reset_Cursor(void)
-{
-  
-  unsigned char i=16;
-  unsigned char data=0xff;
-  
-  LCD_Command = Set_Start_Line_X|0x0; // start line
-  delay();
-  //page 3
-  LCD_Command = Set_Page_Addr_X|3; 
-  delay();
-  //column 0x38
-  LCD_Command = Set_ColH_Addr_X|0x3; 
-  delay();
-  LCD_Command = Set_ColL_Addr_X|0x8;
-  delay();
-  while (i--) // write 16 column
-  {
-    LCD_Data=data;
-    delay();
-  }
-  i=16;
-  //page 4
-  LCD_Command = Set_Page_Addr_X|4; 
-  delay();
-  LCD_Command = Set_ColH_Addr_X|0x3; 
-  delay();
-  LCD_Command = Set_ColL_Addr_X|0x8;
-  delay();
-  while (i--) // write 16 column
-  {
-    LCD_Data=data;
-    delay();
-  }
-}
-
-/*******************************************************************************
-* Function Name  : LCD_Clr_Cursor
-* Description    : clear the cursor at any location --> but only need to 
-                   clear the data in ram at at page 3&4 column (64-8)~(64+8)
-                   as far as where it looks on LCD depends on the y-position
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-signed char x_p;
-void LCD_Clr_Cursor(signed char x)
-{
-  unsigned char i=16;
-  unsigned char data=0x00;
-  
-  unsigned char col_no; //0x38+x
-  unsigned char col_high;
-  unsigned char col_low;
-  col_no=0x40+(x_p/8 -1)*8; //0x38+x
-  col_high=col_no>>4;
-  col_low=col_no&0xf;
-  
-  
-  //page 3
-  LCD_Command = Set_Page_Addr_X|3; 
-  delay();
-  //column 0x38
-  LCD_Command = Set_ColH_Addr_X|col_high; 
-  delay();
-  LCD_Command = Set_ColL_Addr_X|col_low;
-  delay();
-  while (i--) // write 16 column
-  {
-    LCD_Data=data;
-    delay();
-  }
-  i=16;
-  //page 4
-  LCD_Command = Set_Page_Addr_X|4; 
-  delay();
-  LCD_Command = Set_ColH_Addr_X|col_high; 
-  delay();
-  LCD_Command = Set_ColL_Addr_X|col_low;
-  delay();
-  while (i--) // write 16 column
-  {
-    LCD_Data=data;
-    delay();
-  }
-}
-
-/*******************************************************************************
-* Function Name  : LCD_PowerOn
-* Description    : always handle cursor data of ram with page=3/4 no matter 
-                   what is the y-postion and different column corresponding 
-                   to diff x_postion
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void LCD_Set_Cursor(signed char x)
-{
-  unsigned char i=16;
-  unsigned char data=0xff;
-  
-  unsigned char col_no; //0x38+x
-  unsigned char col_high;
-  unsigned char col_low;
-  col_no=0x40+(x/8 -1)*8; //0x38+x
-  col_high=col_no>>4;
-  col_low=col_no&0xf;
-  
-  //page 3
-  LCD_Command = Set_Page_Addr_X|3; 
-  delay();
-  //column diff with x-postion
-  
-  
-  LCD_Command = Set_ColH_Addr_X|col_high; 
-  delay();
-  LCD_Command = Set_ColL_Addr_X|col_low;
-  delay();
-  while (i--) // write 16 column
-  {
-    LCD_Data=data;
-    delay();
-  }
-  i=16;
-  //page 4
-  LCD_Command = Set_Page_Addr_X|4; 
-  delay();
-  LCD_Command = Set_ColH_Addr_X|col_high; 
-  delay();
-  LCD_Command = Set_ColL_Addr_X|col_low;
-  delay();
-  while (i--) // write 16 column
-  {
-    LCD_Data=data;
-    delay();
-  }
-}
-
-
-/*******************************************************************************
-* Function Name  : LCD_PowerOn
-* Description    : Power on the LCD.
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void LCD_PowerOn(void)
-{
-  LCD_Command = 0x2c;
-  delay();
-  LCD_Command = 0x2e;
-  delay();
-  LCD_Command = 0x2f;
-  delay();
-}
-
-/*******************************************************************************
-* Function Name  : LCD_DisplayOn
-* Description    : Enables the Display.
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void LCD_DisplayOn(void)
-{
-  LCD_Command = Display_On;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_DisplayOff
-* Description    : Disables the Display.
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void LCD_DisplayOff(void)
-{
-  LCD_Command = Display_Off;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_CtrlLinesConfig
-* Description    : Configures LCD Control lines (FSMC Pins) in alternate function
-                   Push-Pull mode.
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void LCD_CtrlLinesConfig(void)
-{
-	__HAL_RCC_GPIOA_CLK_ENABLE();
-	__HAL_RCC_GPIOB_CLK_ENABLE();
-	__HAL_RCC_GPIOC_CLK_ENABLE();
-	__HAL_RCC_GPIOD_CLK_ENABLE();
-	__HAL_RCC_GPIOE_CLK_ENABLE();
-	__HAL_RCC_GPIOF_CLK_ENABLE();
-	__HAL_RCC_GPIOG_CLK_ENABLE();
-	
-	__FSMC_CLK_DISABLE();
-	HAL_GPIO_DeInit(GPIOF, GPIO_PIN_0);
-
-  HAL_GPIO_DeInit(GPIOE, GPIO_PIN_7|GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10 
-                          |GPIO_PIN_11|GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14 
-                          |GPIO_PIN_15);
-
-  HAL_GPIO_DeInit(GPIOD, GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10|GPIO_PIN_14 
-                          |GPIO_PIN_15|GPIO_PIN_0|GPIO_PIN_1|GPIO_PIN_4 
-                          |GPIO_PIN_5);
-
-  HAL_GPIO_DeInit(GPIOG, GPIO_PIN_12);
-	
-	GPIO_InitTypeDef GPIO_InitStruct;
-	__FSMC_CLK_ENABLE();
-	
-	GPIO_InitStruct.Pin = GPIO_PIN_0;
-  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-  GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
-  HAL_GPIO_Init(GPIOF, &GPIO_InitStruct);
-
-  GPIO_InitStruct.Pin = GPIO_PIN_7|GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10 
-                          |GPIO_PIN_11|GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14 
-                          |GPIO_PIN_15;
-  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-  GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
-  HAL_GPIO_Init(GPIOE, &GPIO_InitStruct);
-
-  GPIO_InitStruct.Pin = GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10|GPIO_PIN_14 
-                          |GPIO_PIN_15|GPIO_PIN_0|GPIO_PIN_1|GPIO_PIN_4 
-                          |GPIO_PIN_5;
-  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-  GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
-  HAL_GPIO_Init(GPIOD, &GPIO_InitStruct);
-
-  GPIO_InitStruct.Pin = GPIO_PIN_12;
-  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-  GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
-  HAL_GPIO_Init(GPIOG, &GPIO_InitStruct);
-}
-
-/*******************************************************************************
-* Function Name  : LCD_FSMCConfig
-* Description    : Configures the Parallel interface (FSMC) for LCD(Parallel mode)
-* Input          : None
-* Output         : None
-* Return         : None
-*******************************************************************************/
-void LCD_FSMCConfig(void)
-{ 
-  //FSMC_NORSRAMInitTypeDef  FSMC_NORSRAMInitStructure;
-  //FSMC_NORSRAMTimingInitTypeDef  p;
-	SRAM_HandleTypeDef hsram4;
-	FSMC_NORSRAM_TimingTypeDef p;
-
-/*-- FSMC Configuration ------------------------------------------------------*/
-/*----------------------- SRAM Bank 4 ----------------------------------------*/
-  /* FSMC_Bank1_NORSRAM4 configuration */
-  p.AddressSetupTime = 1;
-  p.AddressHoldTime = 1;
-  p.DataSetupTime = 20;
-  p.BusTurnAroundDuration = 0;
-  p.CLKDivision = 0;
-  p.DataLatency = 1;
-  p.AccessMode = (unsigned long)0x00000000;
-
-	hsram4.Instance = FSMC_NORSRAM_DEVICE;
-  hsram4.Extended = FSMC_NORSRAM_EXTENDED_DEVICE;
-  /* Color LCD configuration ------------------------------------
-     LCD configured as follow:
-        - Data/Address MUX = Disable
-        - Memory Type = SRAM
-        - Data Width = 16bit
-        - Write Operation = Enable
-        - Extended Mode = Enable
-        - Asynchronous Wait = Disable */
-  //FSMC_NORSRAMInitStructure.FSMC_Bank = FSMC_Bank1_NORSRAM4;
-	hsram4.Init.NSBank = FSMC_NORSRAM_BANK4;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_DataAddressMux = FSMC_DataAddressMux_Disable;
-	hsram4.Init.DataAddressMux = FSMC_DATA_ADDRESS_MUX_DISABLE;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_MemoryType = FSMC_MemoryType_SRAM;
-	hsram4.Init.MemoryType = FSMC_MEMORY_TYPE_SRAM;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_MemoryDataWidth = FSMC_MemoryDataWidth_8b;
-	hsram4.Init.MemoryDataWidth = FSMC_NORSRAM_MEM_BUS_WIDTH_8;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_BurstAccessMode = FSMC_BurstAccessMode_Disable;
-	hsram4.Init.BurstAccessMode = FSMC_BURST_ACCESS_MODE_DISABLE;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_WaitSignalPolarity = FSMC_WaitSignalPolarity_Low;
-	hsram4.Init.WaitSignalPolarity = FSMC_WAIT_SIGNAL_POLARITY_LOW;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_WrapMode = FSMC_WrapMode_Disable;
-	hsram4.Init.WrapMode = FSMC_WRAP_MODE_DISABLE;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_WaitSignalActive = FSMC_WaitSignalActive_BeforeWaitState;
-	hsram4.Init.WaitSignalActive = FSMC_WAIT_TIMING_BEFORE_WS;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_WriteOperation = FSMC_WriteOperation_Enable;
-	hsram4.Init.WriteOperation = FSMC_WRITE_OPERATION_ENABLE;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_WaitSignal = FSMC_WaitSignal_Disable;
-	hsram4.Init.WaitSignal = FSMC_WAIT_SIGNAL_DISABLE;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_ExtendedMode = FSMC_ExtendedMode_Disable;
-	hsram4.Init.ExtendedMode = FSMC_EXTENDED_MODE_DISABLE;
-	
-  //FSMC_NORSRAMInitStructure.FSMC_WriteBurst = FSMC_WriteBurst_Disable;
-	hsram4.Init.WriteBurst = FSMC_WRITE_BURST_DISABLE;
-	
-	hsram4.Init.AsynchronousWait = FSMC_ASYNCHRONOUS_WAIT_DISABLE;
-  //FSMC_NORSRAMInitStructure.FSMC_ReadWriteTimingStruct = &p;
-  //FSMC_NORSRAMInitStructure.FSMC_WriteTimingStruct = &p;
-	
-	HAL_SRAM_Init(&hsram4, &p, NULL);
-  //FSMC_NORSRAMInit(&FSMC_NORSRAMInitStructure);  
-	__HAL_AFIO_FSMCNADV_DISCONNECTED();
-  /* BANK 4 (of NOR/SRAM Bank 1~4) is enabled */
-	
-  //FSMC_NORSRAMCmd(FSMC_Bank1_NORSRAM4, ENABLE);
-}
-/*******************************************************************************
-* Function Name  : LCD_SetPixel
-* Description    : Set or clear a specific pixel at (x, y) coordinate
-* Input          : x -- x coordinate (0-127, column position)
-                   y -- y coordinate (0-63, row position)
-                   state -- 1: set pixel (turn on), 0: clear pixel (turn off)
-* Output         : None
-* Return         : 0 -- failure (out of bounds)
-                   1 -- success
-* Note           : LCD is organized in 8 pages (0-7), each page contains 8 rows
-                   y/8 gives the page number, y%8 gives the bit position in that page
-*******************************************************************************/
-unsigned char LCD_SetPixel(unsigned char x, unsigned char y, unsigned char state)
-{
-  unsigned char page, bit_position, current_data;
-  unsigned char col_high, col_low;
-  
-  // Boundary check
-  if (x >= 128 || y >= 64)
-    return 0;
-  
-  // Calculate page and bit position
-  page = y / 8;           // Page number (0-7)
-  bit_position = y % 8;   // Bit position within the page (0-7)
-  
-  // Calculate column address
-  col_high = x >> 4;      // High nibble of column
-  col_low = x & 0x0F;     // Low nibble of column
-  
-  // Set page and column address
-  LCD_Command = Set_Page_Addr_X | page;
-  delay();
-  LCD_Command = Set_ColH_Addr_X | col_high;
-  delay();
-  LCD_Command = Set_ColL_Addr_X | col_low;
-  delay();
-  
-  // Read current data (dummy read to set address)
-  current_data = LCD_Data;
-  delay();
-  
-  // Read actual data
-  current_data = LCD_Data;
-  delay();
-  
-  // Modify the specific bit
-  if (state)
-    current_data |= (1 << bit_position);   // Set bit
-  else
-    current_data &= ~(1 << bit_position);  // Clear bit
-  
-  // Write back - need to reset address first
-  LCD_Command = Set_Page_Addr_X | page;
-  delay();
-  LCD_Command = Set_ColH_Addr_X | col_high;
-  delay();
-  LCD_Command = Set_ColL_Addr_X | col_low;
-  delay();
-  
-  // Write modified data
-  LCD_Data = current_data;
-  delay();
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_DrawLine
-* Description    : Draw a horizontal line from (x1, y) to (x2, y)
-* Input          : x1, x2 -- start and end x coordinates (0-127)
-                   y -- y coordinate (0-63)
-                   state -- 1: draw line, 0: erase line
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-*******************************************************************************/
-unsigned char LCD_DrawLine(unsigned char x1, unsigned char x2, unsigned char y, unsigned char state)
-{
-  unsigned char x;
-  unsigned char start_x, end_x;
-  
-  if (y >= 64)
-    return 0;
-  
-  // Ensure x1 <= x2
-  if (x1 <= x2)
-  {
-    start_x = x1;
-    end_x = x2;
-  }
-  else
-  {
-    start_x = x2;
-    end_x = x1;
-  }
-  
-  if (end_x >= 128)
-    end_x = 127;
-  
-  // Draw pixels from start to end
-  for (x = start_x; x <= end_x; x++)
-  {
-    LCD_SetPixel(x, y, state);
-  }
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_DrawRect
-* Description    : Draw a rectangle outline
-* Input          : x1, y1 -- top-left corner coordinates
-                   x2, y2 -- bottom-right corner coordinates
-                   state -- 1: draw, 0: erase
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-*******************************************************************************/
-unsigned char LCD_DrawRect(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state)
-{
-  unsigned char x, y;
-  
-  if (x1 >= 128 || x2 >= 128 || y1 >= 64 || y2 >= 64)
-    return 0;
-  
-  // Draw horizontal lines (top and bottom)
-  for (x = x1; x <= x2; x++)
-  {
-    LCD_SetPixel(x, y1, state);
-    LCD_SetPixel(x, y2, state);
-  }
-  
-  // Draw vertical lines (left and right)
-  for (y = y1; y <= y2; y++)
-  {
-    LCD_SetPixel(x1, y, state);
-    LCD_SetPixel(x2, y, state);
-  }
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_DrawCircle
-* Description    : Draw a circle outline using Bresenham's algorithm
-* Input          : xc, yc -- center coordinates
-                   radius -- circle radius
-                   state -- 1: draw, 0: erase
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-*******************************************************************************/
-unsigned char LCD_DrawCircle(unsigned char xc, unsigned char yc, unsigned char radius, unsigned char state)
-{
-  signed short x = 0;
-  signed short y = radius;
-  signed short d = 3 - 2 * radius;
-  
-  // Boundary check
-  if (xc >= 128 || yc >= 64)
-    return 0;
-  
-  // Draw initial points
-  while (y >= x)
-  {
-    // Draw 8 symmetric points
-    if (xc + x < 128 && yc + y < 64) LCD_SetPixel(xc + x, yc + y, state);
-    if (xc - x < 128 && yc + y < 64) LCD_SetPixel(xc - x, yc + y, state);
-    if (xc + x < 128 && yc - y < 64) LCD_SetPixel(xc + x, yc - y, state);
-    if (xc - x < 128 && yc - y < 64) LCD_SetPixel(xc - x, yc - y, state);
-    if (xc + y < 128 && yc + x < 64) LCD_SetPixel(xc + y, yc + x, state);
-    if (xc - y < 128 && yc + x < 64) LCD_SetPixel(xc - y, yc + x, state);
-    if (xc + y < 128 && yc - x < 64) LCD_SetPixel(xc + y, yc - x, state);
-    if (xc - y < 128 && yc - x < 64) LCD_SetPixel(xc - y, yc - x, state);
-    
-    x++;
-    
-    if (d > 0)
-    {
-      y--;
-      d = d + 4 * (x - y) + 10;
-    }
-    else
-    {
-      d = d + 4 * x + 6;
-    }
-  }
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_FillCircle
-* Description    : Draw a filled circle
-* Input          : xc, yc -- center coordinates
-                   radius -- circle radius
-                   state -- 1: fill, 0: clear
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-*******************************************************************************/
-unsigned char LCD_FillCircle(unsigned char xc, unsigned char yc, unsigned char radius, unsigned char state)
-{
-  signed short x = 0;
-  signed short y = radius;
-  signed short d = 3 - 2 * radius;
-  signed short i;
-  
-  // Boundary check
-  if (xc >= 128 || yc >= 64)
-    return 0;
-  
-  while (y >= x)
-  {
-    // Draw horizontal lines to fill the circle
-    for (i = xc - x; i <= xc + x; i++)
-    {
-      if (i < 128 && yc + y < 64) LCD_SetPixel(i, yc + y, state);
-      if (i < 128 && yc - y < 64) LCD_SetPixel(i, yc - y, state);
-    }
-    
-    for (i = xc - y; i <= xc + y; i++)
-    {
-      if (i < 128 && yc + x < 64) LCD_SetPixel(i, yc + x, state);
-      if (i < 128 && yc - x < 64) LCD_SetPixel(i, yc - x, state);
-    }
-    
-    x++;
-    
-    if (d > 0)
-    {
-      y--;
-      d = d + 4 * (x - y) + 10;
-    }
-    else
-    {
-      d = d + 4 * x + 6;
-    }
-  }
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_DrawVLine
-* Description    : Draw a vertical line
-* Input          : x -- x coordinate
-                   y1, y2 -- start and end y coordinates
-                   state -- 1: draw, 0: erase
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-*******************************************************************************/
-unsigned char LCD_DrawVLine(unsigned char x, unsigned char y1, unsigned char y2, unsigned char state)
-{
-  unsigned char y;
-  unsigned char start_y, end_y;
-  
-  if (x >= 128)
-    return 0;
-  
-  // Ensure y1 <= y2
-  if (y1 <= y2)
-  {
-    start_y = y1;
-    end_y = y2;
-  }
-  else
-  {
-    start_y = y2;
-    end_y = y1;
-  }
-  
-  if (end_y >= 64)
-    end_y = 63;
-  
-  // Draw pixels from start to end
-  for (y = start_y; y <= end_y; y++)
-  {
-    LCD_SetPixel(x, y, state);
-  }
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_FillRect
-* Description    : Draw a filled rectangle
-* Input          : x1, y1 -- top-left corner coordinates
-                   x2, y2 -- bottom-right corner coordinates
-                   state -- 1: fill, 0: clear
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-*******************************************************************************/
-unsigned char LCD_FillRect(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state)
-{
-  unsigned char x, y;
-  unsigned char start_x, end_x, start_y, end_y;
-  
-  // Ensure proper ordering
-  if (x1 <= x2)
-  {
-    start_x = x1;
-    end_x = x2;
-  }
-  else
-  {
-    start_x = x2;
-    end_x = x1;
-  }
-  
-  if (y1 <= y2)
-  {
-    start_y = y1;
-    end_y = y2;
-  }
-  else
-  {
-    start_y = y2;
-    end_y = y1;
-  }
-  
-  // Boundary check
-  if (start_x >= 128 || start_y >= 64)
-    return 0;
-  
-  if (end_x >= 128) end_x = 127;
-  if (end_y >= 64) end_y = 63;
-  
-  // Fill rectangle
-  for (y = start_y; y <= end_y; y++)
-  {
-    for (x = start_x; x <= end_x; x++)
-    {
-      LCD_SetPixel(x, y, state);
-    }
-  }
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_DrawLineAngle
-* Description    : Draw a line at any angle using Bresenham's algorithm
-* Input          : x0, y0 -- start point coordinates
-                   x1, y1 -- end point coordinates
-                   state -- 1: draw, 0: erase
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-*******************************************************************************/
-unsigned char LCD_DrawLineAngle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char state)
-{
-  signed short dx = x1 > x0 ? x1 - x0 : x0 - x1;
-  signed short dy = y1 > y0 ? y1 - y0 : y0 - y1;
-  signed short sx = x0 < x1 ? 1 : -1;
-  signed short sy = y0 < y1 ? 1 : -1;
-  signed short err = dx - dy;
-  signed short e2;
-  signed short cur_x = x0;
-  signed short cur_y = y0;
-  
-  while (1)
-  {
-    // Draw pixel if within bounds
-    if (cur_x >= 0 && cur_x < 128 && cur_y >= 0 && cur_y < 64)
-    {
-      LCD_SetPixel((unsigned char)cur_x, (unsigned char)cur_y, state);
-    }
-    
-    // Check if we've reached the end
-    if (cur_x == x1 && cur_y == y1)
-      break;
-    
-    e2 = 2 * err;
-    
-    if (e2 > -dy)
-    {
-      err -= dy;
-      cur_x += sx;
-    }
-    
-    if (e2 < dx)
-    {
-      err += dx;
-      cur_y += sy;
-    }
-  }
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_DrawTriangle
-* Description    : Draw a triangle outline
-* Input          : x0, y0, x1, y1, x2, y2 -- three vertex coordinates
-                   state -- 1: draw, 0: erase
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-*******************************************************************************/
-unsigned char LCD_DrawTriangle(unsigned char x0, unsigned char y0, 
-                                unsigned char x1, unsigned char y1,
-                                unsigned char x2, unsigned char y2, 
-                                unsigned char state)
-{
-  LCD_DrawLineAngle(x0, y0, x1, y1, state);
-  LCD_DrawLineAngle(x1, y1, x2, y2, state);
-  LCD_DrawLineAngle(x2, y2, x0, y0, state);
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_FillTriangle
-* Description    : Draw a filled triangle
-* Input          : x0, y0, x1, y1, x2, y2 -- three vertex coordinates
-                   state -- 1: fill, 0: clear
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-* Note           : Uses scanline algorithm
-*******************************************************************************/
-unsigned char LCD_FillTriangle(unsigned char x0, unsigned char y0, 
-                                unsigned char x1, unsigned char y1,
-                                unsigned char x2, unsigned char y2, 
-                                unsigned char state)
-{
-  signed short a, b, y, last;
-  signed short dx01, dy01, dx02, dy02, dx12, dy12;
-  signed long sa = 0, sb = 0;
-  unsigned char temp;
-  
-  // Sort coordinates by Y order (y0 <= y1 <= y2)
-  if (y0 > y1) {
-    temp = y0; y0 = y1; y1 = temp;
-    temp = x0; x0 = x1; x1 = temp;
-  }
-  if (y1 > y2) {
-    temp = y2; y2 = y1; y1 = temp;
-    temp = x2; x2 = x1; x1 = temp;
-  }
-  if (y0 > y1) {
-    temp = y0; y0 = y1; y1 = temp;
-    temp = x0; x0 = x1; x1 = temp;
-  }
-  
-  if (y0 == y2) // All on same line
-  {
-    a = b = x0;
-    if (x1 < a)      a = x1;
-    else if (x1 > b) b = x1;
-    if (x2 < a)      a = x2;
-    else if (x2 > b) b = x2;
-    LCD_DrawLine(a, b, y0, state);
-    return 1;
-  }
-  
-  dx01 = x1 - x0;
-  dy01 = y1 - y0;
-  dx02 = x2 - x0;
-  dy02 = y2 - y0;
-  dx12 = x2 - x1;
-  dy12 = y2 - y1;
-  
-  // For upper part of triangle, find scanline crossings
-  if (y1 == y2) last = y1;
-  else          last = y1 - 1;
-  
-  for (y = y0; y <= last; y++)
-  {
-    a = x0 + sa / dy01;
-    b = x0 + sb / dy02;
-    sa += dx01;
-    sb += dx02;
-    
-    if (a > b) { temp = a; a = b; b = temp; }
-    LCD_DrawLine(a, b, y, state);
-  }
-  
-  // For lower part of triangle
-  sa = dx12 * (y - y1);
-  sb = dx02 * (y - y0);
-  for (; y <= y2; y++)
-  {
-    a = x1 + sa / dy12;
-    b = x0 + sb / dy02;
-    sa += dx12;
-    sb += dx02;
-    
-    if (a > b) { temp = a; a = b; b = temp; }
-    LCD_DrawLine(a, b, y, state);
-  }
-  
-  return 1;
-}
-
-/*******************************************************************************
-* Function Name  : LCD_SetArea
-* Description    : Fast fill/clear a rectangular area (optimized for page mode)
-*                  Note: This is optimized for speed but less flexible than FillRect
-*                  Best used when y1 and y2 align with page boundaries (multiples of 8)
-* Input          : x1, y1 -- top-left corner
-                   x2, y2 -- bottom-right corner
-                   state -- 1: fill all pixels, 0: clear all pixels
-* Output         : None
-* Return         : 0 -- failure, 1 -- success
-* Warning        : For partial page boundaries, use LCD_FillRect instead for accuracy
-*******************************************************************************/
-unsigned char LCD_SetArea(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state)
-{
-  unsigned char page_start, page_end, page;
-  unsigned char x;
-  unsigned char mask_top, mask_bottom;
-  unsigned char data;
-  unsigned char col_high, col_low;
-  unsigned char current_data;
-  
-  // Boundary check
-  if (x1 >= 128 || y1 >= 64)
-    return 0;
-  
-  if (x2 >= 128) x2 = 127;
-  if (y2 >= 64) y2 = 63;
-  
-  // Ensure proper ordering
-  if (x1 > x2) { unsigned char temp = x1; x1 = x2; x2 = temp; }
-  if (y1 > y2) { unsigned char temp = y1; y1 = y2; y2 = temp; }
-  
-  page_start = y1 / 8;
-  page_end = y2 / 8;
-  
-  // Calculate masks for partial pages
-  mask_top = 0xFF << (y1 % 8);      // Top page: clear lower bits
-  mask_bottom = 0xFF >> (7 - (y2 % 8));  // Bottom page: clear upper bits
-  
-  // If same page, combine masks
-  if (page_start == page_end)
-  {
-    mask_top &= mask_bottom;
-    mask_bottom = 0;
-  }
-  
-  data = state ? 0xFF : 0x00;
-  
-  // Process each column
-  for (x = x1; x <= x2; x++)
-  {
-    col_high = x >> 4;
-    col_low = x & 0x0F;
-    
-    // Process each page
-    for (page = page_start; page <= page_end; page++)
-    {
-      unsigned char write_data = data;
-      
-      // Apply masks for partial pages
-      if (page == page_start && (y1 % 8) != 0)
-      {
-        // Need to read-modify-write for top boundary
-        LCD_Command = Set_Page_Addr_X | page;
-        delay();
-        LCD_Command = Set_ColH_Addr_X | col_high;
-        delay();
-        LCD_Command = Set_ColL_Addr_X | col_low;
-        delay();
-        
-        current_data = LCD_Data;  // Dummy read
-        delay();
-        current_data = LCD_Data;  // Actual read
-        delay();
-        
-        // Apply mask
-        write_data = (current_data & ~mask_top) | (data & mask_top);
-      }
-      else if (page == page_end && (y2 % 8) != 7 && page_start != page_end)
-      {
-        // Need to read-modify-write for bottom boundary
-        LCD_Command = Set_Page_Addr_X | page;
-        delay();
-        LCD_Command = Set_ColH_Addr_X | col_high;
-        delay();
-        LCD_Command = Set_ColL_Addr_X | col_low;
-        delay();
-        
-        current_data = LCD_Data;  // Dummy read
-        delay();
-        current_data = LCD_Data;  // Actual read
-        delay();
-        
-        // Apply mask
-        write_data = (current_data & ~mask_bottom) | (data & mask_bottom);
-      }
-      
-      // Write data
-      LCD_Command = Set_Page_Addr_X | page;
-      delay();
-      LCD_Command = Set_ColH_Addr_X | col_high;
-      delay();
-      LCD_Command = Set_ColL_Addr_X | col_low;
-      delay();
-      
-      LCD_Data = write_data;
-      delay();
-    }
-  }
-  
-  return 1;
-}
-
-void LCD_Init(void)
-{
-  STM3210E_LCD_Init();
-
-  LCD_Draw_ST_Logo();
-}
+#include "lcd.h"
+#include <stdarg.h>
+#include <string.h>
+
+static unsigned char LCD_LogoInverted;  // 1: LCD_Draw_ST_Logo() draws the logo inverted
+
+/*******************************************************************************
+* Function Name  : Converse_Logo
+* Description    : toggle between the normal and the inverted ST logo; the
+                   image stays in flash, the next LCD_Draw_ST_Logo() inverts
+                   the pixels while drawing
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void Converse_Logo(void)
+{
+  LCD_LogoInverted ^= 1;
+}
+/*******************************************************************************
+* Bus access
+* Every controller access goes through these helpers so LCD_BusStats can count
+* what actually crosses the FSMC bus. In the host build (LCD_HOST) they drive
+* the ST7565 emulator instead of the FSMC window.
+*******************************************************************************/
+LCD_BusStatsTypeDef LCD_BusStats;
+
+// Bus pacing is done by the FSMC timing set up in LCD_FSMCConfig(), every
+// access is stretched in hardware to the controller's minimum cycle time
+static inline void LCD_WriteCommand(unsigned char cmd)
+{
+#ifdef LCD_HOST
+  ST7565_WriteCommand(cmd);
+#else
+  LCD_Command = cmd;
+#endif
+  LCD_BusStats.commands++;
+}
+
+static inline void LCD_WriteData(unsigned char data)
+{
+#ifdef LCD_HOST
+  ST7565_WriteData(data);
+#else
+  LCD_Data = data;
+#endif
+  LCD_BusStats.dataWrites++;
+}
+
+static inline unsigned char LCD_ReadData(void)
+{
+  LCD_BusStats.dataReads++;
+#ifdef LCD_HOST
+  return ST7565_ReadData();
+#else
+  return LCD_Data;
+#endif
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ResetBusStats
+* Description    : zero the bus transaction counters
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_ResetBusStats(void)
+{
+  LCD_BusStats.commands = 0;
+  LCD_BusStats.dataWrites = 0;
+  LCD_BusStats.dataReads = 0;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_WritePage
+* Description    : burst write a run of bytes into one page, the page/column
+                   address is sent once and the controller auto-increments
+                   the column after every data byte
+* Input          : page -- page number (0-7)
+                   col -- first column (0-127)
+                   data -- bytes to write
+                   len -- number of bytes, must not run past column 127
+* Output         : None
+* Return         : None
+* Note           : waits for a running DMA flush, the bus is not shared
+*******************************************************************************/
+void LCD_WritePage(unsigned char page, unsigned char col, const unsigned char *data, unsigned char len)
+{
+  LCD_FlushWait();
+
+  LCD_WriteCommand(Set_Page_Addr_X|page);
+  LCD_WriteCommand(Set_ColH_Addr_X|(col >> 4));
+  LCD_WriteCommand(Set_ColL_Addr_X|(col & 0x0f));
+  while (len--)
+    LCD_WriteData(*data++);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DirectSetArea
+* Description    : fill/clear a rectangle directly in display RAM, without
+                   the framebuffer (bring-up, memory-constrained builds)
+                   Full pages are plain burst writes. Partial pages use the
+                   controller's read-modify-write mode: the column address
+                   is sent once, reads do not advance it and every write
+                   steps to the next column, so each byte costs one read
+                   and one write instead of a full re-addressing
+* Input          : x1, y1 -- top-left corner
+                   x2, y2 -- bottom-right corner
+                   state -- 1: fill all pixels, 0: clear all pixels
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+* Note           : the framebuffer does not see this change, a later flush
+                   of the same columns overwrites it
+*******************************************************************************/
+unsigned char LCD_DirectSetArea(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state)
+{
+  unsigned char page, page_start, page_end, x, mask, data, current;
+  unsigned char temp;
+
+  // Boundary check
+  if (x1 >= 128 || y1 >= 64)
+    return 0;
+
+  if (x2 >= 128) x2 = 127;
+  if (y2 >= 64) y2 = 63;
+
+  // Ensure proper ordering
+  if (x1 > x2) { temp = x1; x1 = x2; x2 = temp; }
+  if (y1 > y2) { temp = y1; y1 = y2; y2 = temp; }
+
+  page_start = y1 / 8;
+  page_end = y2 / 8;
+  data = state ? 0xFF : 0x00;
+
+  LCD_FlushWait();
+
+  for (page = page_start; page <= page_end; page++)
+  {
+    mask = 0xFF;
+    if (page == page_start) mask &= 0xFF << (y1 % 8);
+    if (page == page_end)   mask &= 0xFF >> (7 - (y2 % 8));
+
+    LCD_WriteCommand(Set_Page_Addr_X|page);
+    LCD_WriteCommand(Set_ColH_Addr_X|(x1 >> 4));
+    LCD_WriteCommand(Set_ColL_Addr_X|(x1 & 0x0f));
+
+    if (mask == 0xFF)
+    {
+      for (x = x1; x <= x2; x++)
+        LCD_WriteData(data);
+      continue;
+    }
+
+    LCD_WriteCommand(RMW_Mode_En);
+    LCD_ReadData();  // dummy read after entering RMW mode
+    for (x = x1; x <= x2; x++)
+    {
+      current = LCD_ReadData();
+      LCD_WriteData((current & ~mask) | (data & mask));
+    }
+    LCD_WriteCommand(RMW_Mode_Dis);  // column address returns to x1
+  }
+
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DirectSetPixel
+* Description    : set or clear one pixel directly in display RAM with one
+                   RMW-mode read/write, without the framebuffer
+* Input          : x -- x coordinate (0-127), y -- y coordinate (0-63)
+                   state -- 1: set pixel, 0: clear pixel
+* Output         : None
+* Return         : 0 -- failure (out of bounds), 1 -- success
+*******************************************************************************/
+unsigned char LCD_DirectSetPixel(unsigned char x, unsigned char y, unsigned char state)
+{
+  return LCD_DirectSetArea(x, y, x, y, state);
+}
+
+/*******************************************************************************
+* Layered, double-buffered shadow framebuffer
+* Drawing functions render into the selected layer LCD_FrameBuffer[page][column]
+* (see LCD_SelectLayer()) and record the touched column runs in a per-frame
+* list. At LCD_SwapBuffers() the runs are sorted by page and column and merged,
+* then the compositor merges the layers over those runs only into the back
+* buffer: the background is opaque, playfield pixels that are set cover it
+* (cleared pixels are transparent), and the tile map is drawn on top as the
+* HUD. Within those runs the new frame is compared with the front buffer,
+* which holds what the LCD shows, and only the columns that really changed
+* are queued. The back buffer then becomes the front buffer and the queued
+* runs are streamed to the controller, one address setup each, while drawing
+* of the next frame continues.
+*******************************************************************************/
+#define LCD_FB_SIZE  (LCD_PAGES * LCD_WIDTH)
+
+static unsigned char LCD_Layers[LCD_LAYER_COUNT][LCD_PAGES][LCD_WIDTH];
+static union
+{
+  unsigned char bytes[2][LCD_PAGES][LCD_WIDTH];
+  uint32_t words[2][LCD_PAGES][LCD_WIDTH / 4];  // word alignment for the frame diff
+} LCD_Buffers;
+static unsigned char (*LCD_FrameBuffer)[LCD_WIDTH] = LCD_Layers[LCD_LAYER_BACKGROUND];  // layer drawn into
+static unsigned char (*LCD_BackBuffer)[LCD_WIDTH] = LCD_Buffers.bytes[0];   // composited frame
+static unsigned char (*LCD_FrontBuffer)[LCD_WIDTH] = LCD_Buffers.bytes[1];  // shown on the LCD, read by the flush
+
+#if LCD_SHIFT_CACHE && LCD_SHIFT_FRAMES > 0
+// preshift sprite frames moved down by 1-7 rows, spread over 3 pages
+static unsigned char LCD_ShiftCache[LCD_SHIFT_FRAMES][7][3][LCD_SHIFT_WIDTH];
+#endif
+
+#define LCD_RUN_MAX        64  // dirty runs recorded per frame before they are compacted
+#define LCD_RUN_MERGE_GAP  3   // clean columns between two dirty runs that are merged
+
+typedef struct
+{
+  unsigned char page;
+  unsigned char start;  // first column
+  unsigned char end;    // last column (inclusive)
+} LCD_RunTypeDef;
+
+static LCD_RunTypeDef LCD_Runs[LCD_RUN_MAX];  // dirty runs of the frame being drawn
+static unsigned char LCD_RunCount;
+static unsigned char LCD_DiffGap = LCD_DIFF_GAP;  // see LCD_SetDiffGap()
+static unsigned char LCD_DiffSkip;                // 1: display RAM unknown, send the dirty runs as they are
+static unsigned char LCD_Reverse;                 // 1: the controller shows the display inverted
+static unsigned char LCD_ReverseRequest;          // state asked for by LCD_SetReverse()
+
+LCD_FrameStatsTypeDef LCD_FrameStats;
+
+/*******************************************************************************
+* Tile map
+* Grid-aligned content (text, score) can be kept as a 16x8 map of 8x8 cells,
+* each holding the index of an 8-byte half glyph of ChineseTable[]. A cell is
+* only marked in the 128-bit dirty bitmap (16 bits per page) when its index
+* changes, or when drawing into a layer below touches it; a second bitmap of
+* the occupied cells makes that check free on pages without tiles.
+* LCD_TileRender() copies the dirty cells into the back buffer in page/column
+* order on top of the layers, so the flush cost follows what changed rather
+* than the draw calls. The HUD keeps its static labels here.
+*******************************************************************************/
+static unsigned short LCD_TileMap[LCD_PAGES][LCD_TILE_COLS];
+static unsigned short LCD_TileDirty[LCD_PAGES];  // bit n = cell n of the page
+static unsigned short LCD_TileUsed[LCD_PAGES];   // bit n = cell n holds a tile
+
+/*******************************************************************************
+* Function Name  : LCD_MergeRuns
+* Description    : sort the dirty runs by page and column, then merge runs of
+                   the same page that overlap or are at most gap columns apart
+* Input          : gap -- clean columns allowed between merged runs,
+                          LCD_WIDTH leaves one run per page
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_MergeRuns(unsigned char gap)
+{
+  LCD_RunTypeDef run, *out;
+  unsigned char i, j;
+
+  if (LCD_RunCount == 0)
+    return;
+
+  // insertion sort, the runs are mostly recorded in order already
+  for (i = 1; i < LCD_RunCount; i++)
+  {
+    run = LCD_Runs[i];
+    for (j = i; j > 0 && (LCD_Runs[j - 1].page > run.page ||
+                          (LCD_Runs[j - 1].page == run.page && LCD_Runs[j - 1].start > run.start)); j--)
+      LCD_Runs[j] = LCD_Runs[j - 1];
+    LCD_Runs[j] = run;
+  }
+
+  out = LCD_Runs;
+  for (i = 1; i < LCD_RunCount; i++)
+  {
+    if (LCD_Runs[i].page == out->page && LCD_Runs[i].start <= out->end + gap + 1)
+    {
+      if (LCD_Runs[i].end > out->end)
+        out->end = LCD_Runs[i].end;
+    }
+    else
+      *++out = LCD_Runs[i];
+  }
+  LCD_RunCount = out - LCD_Runs + 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_MarkSpan
+* Description    : record columns col1..col2 of a page as dirty; a run that
+                   continues the last recorded one is folded into it
+* Input          : page -- page number (0-7)
+                   col1, col2 -- first and last column (inclusive, col1 <= col2)
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_MarkSpan(unsigned char page, unsigned char col1, unsigned char col2)
+{
+  LCD_RunTypeDef *run;
+
+  if (LCD_RunCount > 0)
+  {
+    run = &LCD_Runs[LCD_RunCount - 1];
+    if (run->page == page && col1 <= run->end + 1 && col2 + 1 >= run->start)
+    {
+      if (col1 < run->start) run->start = col1;
+      if (col2 > run->end) run->end = col2;
+      return;
+    }
+  }
+
+  // list full: compact it, in the worst case down to one run per page
+  if (LCD_RunCount == LCD_RUN_MAX)
+    LCD_MergeRuns(LCD_RUN_MERGE_GAP);
+  if (LCD_RunCount == LCD_RUN_MAX)
+    LCD_MergeRuns(LCD_WIDTH);
+
+  run = &LCD_Runs[LCD_RunCount++];
+  run->page = page;
+  run->start = col1;
+  run->end = col2;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_MarkTiles
+* Description    : mark the tile cells under columns col1..col2 of a page for
+                   rendering again, after the back buffer there was overwritten
+* Input          : page -- page number (0-7)
+                   col1, col2 -- first and last column (inclusive, col1 <= col2)
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_MarkTiles(unsigned char page, unsigned char col1, unsigned char col2)
+{
+  unsigned short used = LCD_TileUsed[page];
+
+  if (used == 0)
+    return;
+  LCD_TileDirty[page] |= used & (unsigned short)((2U << (col2 / 8)) - (1U << (col1 / 8)));
+}
+
+/*******************************************************************************
+* Function Name  : LCD_MarkDirty
+* Description    : record columns col1..col2 of a page as dirty after drawing
+                   into a layer; tile cells under them are rendered again
+* Input          : page -- page number (0-7)
+                   col1, col2 -- first and last column (inclusive, col1 <= col2)
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_MarkDirty(unsigned char page, unsigned char col1, unsigned char col2)
+{
+  LCD_MarkSpan(page, col1, col2);
+  LCD_MarkTiles(page, col1, col2);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_Invalidate
+* Description    : mark the whole framebuffer dirty so the next LCD_Flush()
+                   resends every page, without the frame diff; call it after
+                   display RAM was written around the framebuffer
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_Invalidate(void)
+{
+  unsigned char page;
+
+  LCD_DiffSkip = 1;
+  LCD_RunCount = 0;
+  for (page = 0; page < LCD_PAGES; page++)
+    LCD_MarkSpan(page, 0, LCD_WIDTH - 1);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_SelectLayer
+* Description    : choose the layer all following drawing goes to
+* Input          : layer -- LCD_LAYER_BACKGROUND or LCD_LAYER_PLAYFIELD
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_SelectLayer(LCD_LayerTypeDef layer)
+{
+  if (layer < LCD_LAYER_COUNT)
+    LCD_FrameBuffer = LCD_Layers[layer];
+}
+
+/*******************************************************************************
+* Function Name  : LCD_Composite
+* Description    : merge the layers into the back buffer over the dirty runs:
+                   opaque background, set playfield pixels on top of it
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_Composite(void)
+{
+  const LCD_RunTypeDef *run;
+  const unsigned char *bg, *pf;
+  unsigned char *dst;
+  unsigned char i, col;
+
+  for (i = 0; i < LCD_RunCount; i++)
+  {
+    run = &LCD_Runs[i];
+    bg = &LCD_Layers[LCD_LAYER_BACKGROUND][run->page][run->start];
+    pf = &LCD_Layers[LCD_LAYER_PLAYFIELD][run->page][run->start];
+    dst = &LCD_BackBuffer[run->page][run->start];
+    for (col = run->start; col <= run->end; col++)
+      *dst++ = *bg++ | *pf++;
+
+    // merged gaps may reach into tile cells no drawing touched
+    LCD_MarkTiles(run->page, run->start, run->end);
+  }
+}
+
+/*******************************************************************************
+* Function Name  : LCD_TileSet
+* Description    : set the content of one tile cell; the cell is rendered
+                   again only when the index actually changes
+* Input          : page -- page number (0-7)
+                   cell -- cell column (0-15), covers columns 8*cell..8*cell+7
+                   tile -- LCD_TILE(glyph, half), or LCD_TILE_NONE to hand
+                           the cell back to the layers below
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_TileSet(unsigned char page, unsigned char cell, unsigned short tile)
+{
+  if (page >= LCD_PAGES || cell >= LCD_TILE_COLS || LCD_TileMap[page][cell] == tile)
+    return;
+
+  LCD_TileMap[page][cell] = tile;
+  if (tile != LCD_TILE_NONE)
+  {
+    LCD_TileUsed[page] |= 1 << cell;
+    LCD_TileDirty[page] |= 1 << cell;
+  }
+  else
+  {
+    LCD_TileUsed[page] &= ~(1 << cell);
+    LCD_MarkSpan(page, cell * 8, cell * 8 + 7);  // composite the layers there again
+  }
+}
+
+/*******************************************************************************
+* Function Name  : LCD_TileSetString
+* Description    : place a row of 8x16 glyphs on the tile map, the upper
+                   halves on page, the lower halves on page + 1
+* Input          : page -- page of the upper halves (0-7)
+                   cell -- first cell column (0-15)
+                   c -- glyph offsets in the ChineseTable[]
+                   length -- number of glyphs, cells past column 15 are dropped
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_TileSetString(unsigned char page, unsigned char cell, const unsigned char *c, unsigned char length)
+{
+  unsigned char n;
+
+  for (n = 0; n < length; n++)
+  {
+    LCD_TileSet(page, cell + n, LCD_TILE(c[n], 0));
+    LCD_TileSet(page + 1, cell + n, LCD_TILE(c[n], 1));
+  }
+}
+
+/*******************************************************************************
+* Function Name  : LCD_TileRender
+* Description    : copy the dirty tile cells into the back buffer, in page and
+                   column order, over the composited layers; called by
+                   LCD_SwapBuffers() before a frame is shown
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_TileRender(void)
+{
+  unsigned char page, cell;
+  unsigned short bits;
+
+  for (page = 0; page < LCD_PAGES; page++)
+  {
+    bits = LCD_TileDirty[page];
+    if (bits == 0)
+      continue;
+    LCD_TileDirty[page] = 0;
+
+    for (cell = 0; bits; cell++, bits >>= 1)
+    {
+      if ((bits & 1) && LCD_TileMap[page][cell] != LCD_TILE_NONE)
+      {
+        memcpy(&LCD_BackBuffer[page][cell * 8], ChineseTable[0] + 8 * LCD_TileMap[page][cell], 8);
+        LCD_MarkSpan(page, cell * 8, cell * 8 + 7);
+      }
+    }
+  }
+}
+
+/*******************************************************************************
+* Function Name  : LCD_TileClear
+* Description    : empty the tile map, every cell goes back to pixel drawing
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_TileClear(void)
+{
+  unsigned char page, cell;
+
+  for (page = 0; page < LCD_PAGES; page++)
+  {
+    for (cell = 0; cell < LCD_TILE_COLS; cell++)
+      LCD_TileMap[page][cell] = LCD_TILE_NONE;
+    LCD_TileDirty[page] = 0;
+    LCD_TileUsed[page] = 0;
+  }
+}
+
+/*******************************************************************************
+* DMA flush engine
+* LCD_SwapBuffers() hands the sorted dirty runs of the new front buffer to
+* the engine, which walks them from the DMA completion interrupt: for every
+* run the CPU sends the three address commands, then a memory-to-memory DMA
+* transfer streams the run from the front buffer (incrementing source) to
+* LCD_Data (fixed destination). The FSMC paces each byte, so the CPU is free
+* until the last run is done.
+*******************************************************************************/
+DMA_HandleTypeDef hdma_lcd;
+static LCD_RunTypeDef LCD_FlushRuns[LCD_RUN_MAX];  // runs being flushed from the front buffer
+static unsigned char LCD_FlushCount;
+static volatile unsigned char LCD_FlushIndex;      // next run the engine sends
+static volatile unsigned char LCD_FlushRunning;    // 1 while a flush is in progress
+
+static void LCD_DMA_XferCplt(DMA_HandleTypeDef *hdma);
+
+/*******************************************************************************
+* Function Name  : LCD_DMAStart
+* Description    : start streaming a run from the front buffer to LCD_Data,
+                   LCD_DMA_XferCplt() is called when it is done. The host
+                   build hands the bytes to the emulator and completes at once
+* Input          : src -- first byte, len -- number of bytes
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_DMAStart(const unsigned char *src, unsigned char len)
+{
+#ifdef LCD_HOST
+  while (len--)
+    ST7565_WriteData(*src++);
+  LCD_DMA_XferCplt(&hdma_lcd);
+#else
+  HAL_DMA_Start_IT(&hdma_lcd, (uint32_t)src, (uint32_t)&LCD_Data, len);
+#endif
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DMAFillStart
+* Description    : start writing the same byte len times to LCD_Data: the
+                   source increment is switched off for the transfer, so a
+                   single byte in memory feeds the whole run. Polled with
+                   LCD_DMAFillWait(), no completion interrupt; the host build
+                   hands the bytes to the emulator at once
+* Input          : value -- the byte, must stay valid until the fill is done
+                   len -- number of bytes
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_DMAFillStart(const unsigned char *value, unsigned char len)
+{
+  LCD_BusStats.dataWrites += len;
+#ifdef LCD_HOST
+  while (len--)
+    ST7565_WriteData(*value);
+#else
+  __HAL_DMA_DISABLE(&hdma_lcd);
+  CLEAR_BIT(hdma_lcd.Instance->CCR, DMA_CCR_PINC);
+  HAL_DMA_Start(&hdma_lcd, (uint32_t)value, (uint32_t)&LCD_Data, len);
+#endif
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DMAFillWait
+* Description    : wait for the fill started by LCD_DMAFillStart() and give
+                   the channel its incrementing source back for the flush
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_DMAFillWait(void)
+{
+#ifndef LCD_HOST
+  HAL_DMA_PollForTransfer(&hdma_lcd, HAL_DMA_FULL_TRANSFER, HAL_MAX_DELAY);
+  __HAL_DMA_DISABLE(&hdma_lcd);
+  SET_BIT(hdma_lcd.Instance->CCR, DMA_CCR_PINC);
+#endif
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FlushNext
+* Description    : start the DMA transfer of the next dirty run, or end the
+                   flush when no run is left
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_FlushNext(void)
+{
+  const LCD_RunTypeDef *run;
+  unsigned char len;
+
+  if (LCD_FlushIndex >= LCD_FlushCount)
+  {
+    LCD_FlushRunning = 0;
+    return;
+  }
+
+  run = &LCD_FlushRuns[LCD_FlushIndex++];
+  len = run->end - run->start + 1;
+
+  LCD_WriteCommand(Set_Page_Addr_X|run->page);
+  LCD_WriteCommand(Set_ColH_Addr_X|(run->start >> 4));
+  LCD_WriteCommand(Set_ColL_Addr_X|(run->start & 0x0f));
+  LCD_BusStats.dataWrites += len;
+  LCD_DMAStart(&LCD_FrontBuffer[run->page][run->start], len);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DiffRuns
+* Description    : compare the new frame in the back buffer with the front
+                   buffer over the dirty runs, a 32-bit word at a time, and
+                   queue only the changed columns for the flush. Changed
+                   columns at most LCD_DiffGap apart are sent as one run,
+                   since re-addressing costs 3 commands
+* Input          : None
+* Output         : None
+* Return         : None
+* Note           : outside the dirty runs both buffers are equal, so whole
+                   words can be compared at the run edges
+*******************************************************************************/
+static void LCD_DiffRuns(void)
+{
+  const LCD_RunTypeDef *run;
+  LCD_RunTypeDef *out = 0;
+  const uint32_t *back, *front;
+  uint32_t diff;
+  unsigned char i, w, col, last, gap;
+
+  LCD_FlushCount = 0;
+  for (i = 0; i < LCD_RunCount; i++)
+  {
+    run = &LCD_Runs[i];
+    back = (const uint32_t *)LCD_BackBuffer[run->page];
+    front = (const uint32_t *)LCD_FrontBuffer[run->page];
+
+    for (w = run->start / 4; w <= run->end / 4; w++)
+    {
+      diff = back[w] ^ front[w];
+      if (diff == 0)
+        continue;
+
+      // first and last changed byte, the lowest address is the low byte
+      col = w * 4;
+      while ((diff & 0xFF) == 0)
+      {
+        diff >>= 8;
+        col++;
+      }
+      for (last = col; diff > 0xFF; last++)
+        diff >>= 8;
+
+      // keep room for one run on each remaining page, then merge per page
+      gap = (LCD_FlushCount < LCD_RUN_MAX - LCD_PAGES) ? LCD_DiffGap : LCD_WIDTH;
+      if (out && out->page == run->page && col <= out->end + gap + 1)
+      {
+        out->end = last;
+        continue;
+      }
+      out = &LCD_FlushRuns[LCD_FlushCount++];
+      out->page = run->page;
+      out->start = col;
+      out->end = last;
+    }
+  }
+}
+
+/*******************************************************************************
+* Function Name  : LCD_SetDiffGap
+* Description    : set how many unchanged columns the frame diff sends to
+                   join two changed runs of a page instead of re-addressing
+* Input          : gap -- columns, 3 matches the cost of one address setup
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_SetDiffGap(unsigned char gap)
+{
+  LCD_DiffGap = gap;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_SetReverse
+* Description    : show the display inverted or normal. The Display_Reverse or
+                   Display_Normal command is sent by the next LCD_SwapBuffers()
+                   between two flushes, never in the middle of a DMA run, so
+                   the change appears with that frame
+* Input          : on -- 1: inverted, 0: normal
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_SetReverse(unsigned char on)
+{
+  LCD_ReverseRequest = (on != 0);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DMA_XferCplt
+* Description    : DMA transfer complete callback, chains the next run
+* Input          : hdma -- DMA handle
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_DMA_XferCplt(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  LCD_FlushNext();
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DMAConfig
+* Description    : Configures the DMA channel used to flush the framebuffer
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_DMAConfig(void)
+{
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  hdma_lcd.Instance = LCD_DMA_CHANNEL;
+  hdma_lcd.Init.Direction = DMA_MEMORY_TO_MEMORY;
+  hdma_lcd.Init.PeriphInc = DMA_PINC_ENABLE;        // source: front buffer
+  hdma_lcd.Init.MemInc = DMA_MINC_DISABLE;          // destination: LCD_Data
+  hdma_lcd.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_lcd.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_lcd.Init.Mode = DMA_NORMAL;
+  hdma_lcd.Init.Priority = DMA_PRIORITY_HIGH;
+  HAL_DMA_Init(&hdma_lcd);
+  hdma_lcd.XferCpltCallback = LCD_DMA_XferCplt;
+
+  HAL_NVIC_SetPriority(LCD_DMA_IRQn, 2, 0);
+  HAL_NVIC_EnableIRQ(LCD_DMA_IRQn);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_SwapBuffers
+* Description    : present the frame: sort and merge the dirty runs,
+                   composite them from the layers into the back buffer, diff
+                   them against the front buffer, swap front and back, start
+                   the DMA flush of the changed runs from the new front buffer
+                   and return immediately. The new back buffer is brought up
+                   to date by copying the same runs, so drawing of the next
+                   frame can start right away
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_SwapBuffers(void)
+{
+  unsigned char (*buffer)[LCD_WIDTH];
+  const LCD_RunTypeDef *run;
+  unsigned long bytes = 0;
+  unsigned char i;
+
+  // merge the layers where they changed, the HUD tiles go on top; the tile
+  // runs join the list afterwards, so it is merged a second time
+  LCD_MergeRuns(LCD_RUN_MERGE_GAP);
+  LCD_Composite();
+  LCD_TileRender();
+  LCD_MergeRuns(LCD_RUN_MERGE_GAP);
+
+  // the flush queue is free and the old front buffer, which becomes the
+  // back buffer, is not read anymore once the last frame has been sent
+  LCD_FlushWait();
+
+  if (LCD_ReverseRequest != LCD_Reverse)
+  {
+    LCD_WriteCommand(LCD_ReverseRequest ? Display_Reverse : Display_Normal);
+    LCD_Reverse = LCD_ReverseRequest;
+  }
+
+  if (LCD_DiffSkip)
+  {
+    memcpy(LCD_FlushRuns, LCD_Runs, LCD_RunCount * sizeof(LCD_RunTypeDef));
+    LCD_FlushCount = LCD_RunCount;
+    LCD_DiffSkip = 0;
+  }
+  else
+    LCD_DiffRuns();
+  LCD_RunCount = 0;
+
+  buffer = LCD_FrontBuffer;
+  LCD_FrontBuffer = LCD_BackBuffer;
+  LCD_BackBuffer = buffer;
+
+  // only the changed runs differ between the two buffers
+  for (i = 0; i < LCD_FlushCount; i++)
+  {
+    run = &LCD_FlushRuns[i];
+    memcpy(&LCD_BackBuffer[run->page][run->start], &LCD_FrontBuffer[run->page][run->start],
+           run->end - run->start + 1);
+    bytes += run->end - run->start + 1;
+  }
+
+  LCD_FrameStats.frames++;
+  LCD_FrameStats.lastCommands = 3 * LCD_FlushCount;
+  LCD_FrameStats.lastBytes = bytes;
+  LCD_FrameStats.commands += LCD_FrameStats.lastCommands;
+  LCD_FrameStats.bytes += bytes;
+
+  LCD_FlushRunning = 1;
+  LCD_FlushIndex = 0;
+  LCD_FlushNext();
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ResetFrameStats
+* Description    : zero the per-frame flush counters
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_ResetFrameStats(void)
+{
+  memset(&LCD_FrameStats, 0, sizeof(LCD_FrameStats));
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FlushBusy
+* Description    : check whether a flush is still being transferred
+* Input          : None
+* Output         : None
+* Return         : 1 -- flush in progress, 0 -- idle
+*******************************************************************************/
+unsigned char LCD_FlushBusy(void)
+{
+  return LCD_FlushRunning;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FlushWait
+* Description    : wait until a running flush has finished
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_FlushWait(void)
+{
+  while (LCD_FlushRunning)
+  {
+  }
+}
+
+/*******************************************************************************
+* Function Name  : LCD_Flush
+* Description    : show the back buffer on the LCD and wait until it is sent
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_Flush(void)
+{
+  LCD_SwapBuffers();
+  LCD_FlushWait();
+}
+
+/*******************************************************************************
+* Function Name  : LCD_Draw_ST_Logo
+* Description    : draw a ST logo
+* Input          : None
+* Output         : None
+* Return         : 0 -- failure
+                   1 -- success
+*******************************************************************************/
+void LCD_Draw_ST_Logo()
+{
+  unsigned char (*layer)[LCD_WIDTH];
+
+  LCD_FlushWait();
+  LCD_WriteCommand(COM_Scan_Dir_Reverse);
+  LCD_WriteCommand(Set_Start_Line_X|0x0);
+
+  // the logo covers the whole background layer, decoded and inverted while
+  // drawing if Converse_Logo() asked for it, so the image can stay in flash
+  layer = LCD_FrameBuffer;
+  LCD_FrameBuffer = LCD_Layers[LCD_LAYER_BACKGROUND];
+  LCD_DrawImage(0, 0, IMAGE_ST_LOGO, LCD_LogoInverted ? LCD_BLIT_INVERT : LCD_BLIT_COPY);
+  LCD_FrameBuffer = layer;
+  memset(LCD_Layers[LCD_LAYER_PLAYFIELD], 0x0, LCD_FB_SIZE);
+  LCD_Invalidate();
+  LCD_Flush();
+}
+/*******************************************************************************
+* Function Name  : LCD_DrawChar
+* Description    : draw an char at certain postion into the framebuffer
+* Input          : Xpage -- postion of page
+                   YCol -- postion of colomn
+                   offset -- font offset in the ChineseTable[]
+* Output         : None
+* Return         : 0 -- failure
+                   1 -- success
+*******************************************************************************/
+void LCD_DrawChar(unsigned char Xpage, unsigned char YCol, unsigned char offset)
+{  
+  unsigned char i, end;
+  const unsigned char *c = ChineseTable[0]+16*offset;
+
+  if (Xpage >= LCD_PAGES || YCol >= LCD_WIDTH)
+    return;
+
+  // clip glyphs that run off the right edge
+  end = (YCol > LCD_WIDTH - 8) ? LCD_WIDTH - 1 : YCol + 7;
+
+  for (i = 0; i <= end - YCol; i++)
+    LCD_FrameBuffer[Xpage][YCol + i] = c[i];
+  LCD_MarkDirty(Xpage, YCol, end);
+
+  // lower half of the 8x16 glyph goes to the next page
+  if (Xpage + 1 < LCD_PAGES)
+  {
+    for (i = 0; i <= end - YCol; i++)
+      LCD_FrameBuffer[Xpage + 1][YCol + i] = c[8 + i];
+    LCD_MarkDirty(Xpage + 1, YCol, end);
+  }
+}
+/*******************************************************************************
+* Function Name  : LCD_DrawString
+* Description    : draw a string of length at certain postion
+                   The glyphs are copied into both framebuffer pages as one
+                   continuous row, so the flush sends each page as a single
+                   burst instead of re-addressing for every glyph
+* Input          : Xpage -- postion of page
+                   YCol -- postion of colomn
+                   c -- pointer to the string to be displayed
+                   length -- length of string
+* Output         : None
+* Return         : 0 -- failure
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawString(unsigned char Xpage, unsigned char YCol, const unsigned char *c, unsigned char length)
+{
+  unsigned char half, i, n;
+  unsigned char *dst;
+  const unsigned char *glyph;
+
+  if (length == 0 || Xpage >= LCD_PAGES || (128-YCol)<8*length)
+    return 0;
+
+  // half 0 = upper 8 rows of every glyph, half 1 = lower 8 rows on the next page
+  for (half = 0; half < 2 && Xpage + half < LCD_PAGES; half++)
+  {
+    dst = &LCD_FrameBuffer[Xpage + half][YCol];
+    for (n = 0; n < length; n++)
+    {
+      glyph = ChineseTable[c[n]] + 8*half;
+      for (i = 0; i < 8; i++)
+        *dst++ = glyph[i];
+    }
+    LCD_MarkDirty(Xpage + half, YCol, YCol + 8*length - 1);
+  }
+  return 1;
+}
+/*******************************************************************************
+* Function Name  : LCD_TextGlyphs
+* Description    : map an ASCII string to font glyphs through LCD_AsciiGlyphs[],
+                   characters without a glyph become ' '
+* Input          : s -- zero terminated string
+                   glyphs -- receives the offsets in the ChineseTable[]
+                   max -- size of glyphs, longer strings are cut off
+* Output         : None
+* Return         : number of glyphs
+*******************************************************************************/
+unsigned char LCD_TextGlyphs(const char *s, unsigned char *glyphs, unsigned char max)
+{
+  unsigned char n, ch;
+
+  for (n = 0; n < max && s[n]; n++)
+  {
+    ch = (unsigned char)s[n];
+    if (ch < LCD_ASCII_FIRST || ch > LCD_ASCII_LAST)
+      ch = ' ';
+    glyphs[n] = LCD_AsciiGlyphs[ch - LCD_ASCII_FIRST];
+  }
+  return n;
+}
+/*******************************************************************************
+* Function Name  : LCD_TextWidth
+* Description    : width of a string in the 8x16 font
+* Input          : s -- zero terminated string
+* Output         : None
+* Return         : pixels
+*******************************************************************************/
+unsigned int LCD_TextWidth(const char *s)
+{
+  return 8 * strlen(s);
+}
+/*******************************************************************************
+* Function Name  : LCD_DrawText
+* Description    : draw an ASCII string in the 8x16 font into the framebuffer
+                   The whole string goes through LCD_DrawString(), one row
+                   per page. Text running off the right edge is cut off at
+                   the last whole glyph
+* Input          : Xpage -- postion of page
+                   YCol -- postion of colomn, or LCD_TEXT_CENTER to centre the
+                           string, LCD_TEXT_RIGHT to end it at the right edge
+                   s -- zero terminated string
+* Output         : None
+* Return         : 0 -- failure
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawText(unsigned char Xpage, unsigned char YCol, const char *s)
+{
+  unsigned char glyphs[LCD_TEXT_MAX];
+  unsigned char length = LCD_TextGlyphs(s, glyphs, LCD_TEXT_MAX);
+
+  if (YCol == LCD_TEXT_CENTER)
+    YCol = (LCD_WIDTH - 8*length) / 2;
+  else if (YCol == LCD_TEXT_RIGHT)
+    YCol = LCD_WIDTH - 8*length;
+  else if (YCol >= LCD_WIDTH)
+    return 0;
+
+  if (length > (LCD_WIDTH - YCol) / 8)
+    length = (LCD_WIDTH - YCol) / 8;
+  return LCD_DrawString(Xpage, YCol, glyphs, length);
+}
+/*******************************************************************************
+* Function Name  : LCD_FormatPut
+* Description    : append one character to the LCD_Format() output
+* Input          : buf -- destination
+                   size -- bytes in buf
+                   n -- characters written so far, advanced
+                   c -- character
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static inline void LCD_FormatPut(char *buf, unsigned char size, unsigned char *n, char c)
+{
+  if (*n + 1 < size)
+    buf[(*n)++] = c;
+}
+/*******************************************************************************
+* Function Name  : LCD_Format
+* Description    : small vsnprintf() for the text functions, so the firmware
+                   does not pull in the C library one: %d %i %u %x %X %c %s
+                   and %%, the flags '-' (left align) and '0' (zero pad), a
+                   field width and the l length modifier. Anything else is
+                   copied as it is
+* Input          : buf -- destination, always zero terminated
+                   size -- bytes in buf, output beyond size - 1 is cut off
+                   fmt -- format string
+                   args -- arguments
+* Output         : None
+* Return         : characters written, the terminator not counted
+*******************************************************************************/
+static unsigned char LCD_Format(char *buf, unsigned char size, const char *fmt, va_list args)
+{
+  static const char hex[] = "0123456789abcdef0123456789ABCDEF";
+  char digits[3 * sizeof(unsigned long)], *p;
+  const char *text = digits;
+  unsigned long value;
+  unsigned int len = 0, width, pad;
+  unsigned char n = 0, left, zero, isLong, negative, base, upper;
+  long sval;
+
+  if (size == 0)
+    return 0;
+
+  for (; *fmt; fmt++)
+  {
+    if (*fmt != '%')
+    {
+      LCD_FormatPut(buf, size, &n, *fmt);
+      continue;
+    }
+
+    // flags, width and length modifier
+    left = zero = isLong = negative = 0;
+    width = 0;
+    for (fmt++; *fmt == '-' || *fmt == '0'; fmt++)
+    {
+      if (*fmt == '-')
+        left = 1;
+      else
+        zero = 1;
+    }
+    while (*fmt >= '0' && *fmt <= '9')
+      width = width*10 + (*fmt++ - '0');
+    if (*fmt == 'l')
+    {
+      isLong = 1;
+      fmt++;
+    }
+    if (*fmt == '\0')
+      break;
+
+    // conversion into text/len, numbers are built backwards in digits[]
+    base = upper = 0;
+    value = 0;
+    switch (*fmt)
+    {
+      case 'd':
+      case 'i':
+        sval = isLong ? va_arg(args, long) : va_arg(args, int);
+        negative = sval < 0;
+        value = negative ? 0UL - (unsigned long)sval : (unsigned long)sval;
+        base = 10;
+        break;
+      case 'u':
+        value = isLong ? va_arg(args, unsigned long) : va_arg(args, unsigned int);
+        base = 10;
+        break;
+      case 'X':
+        upper = 16;
+        /* fall through */
+      case 'x':
+        value = isLong ? va_arg(args, unsigned long) : va_arg(args, unsigned int);
+        base = 16;
+        break;
+      case 'c':
+        digits[0] = (char)va_arg(args, int);
+        text = digits;
+        len = 1;
+        break;
+      case 's':
+        text = va_arg(args, const char *);
+        len = strlen(text);
+        break;
+      default:  // %% and unknown conversions
+        digits[0] = *fmt;
+        text = digits;
+        len = 1;
+        zero = 0;
+        break;
+    }
+    if (base)
+    {
+      p = digits + sizeof(digits);
+      do
+      {
+        *--p = hex[upper + value % base];
+        value /= base;
+      } while (value);
+      text = p;
+      len = digits + sizeof(digits) - p;
+    }
+    else
+      zero = 0;
+
+    // padding, the sign goes in front of zeros and behind spaces
+    pad = (width > len + negative) ? width - len - negative : 0;
+    if (negative && zero)
+      LCD_FormatPut(buf, size, &n, '-');
+    for (; !left && pad; pad--)
+      LCD_FormatPut(buf, size, &n, zero ? '0' : ' ');
+    if (negative && !zero)
+      LCD_FormatPut(buf, size, &n, '-');
+    while (len--)
+      LCD_FormatPut(buf, size, &n, *text++);
+    for (; pad; pad--)
+      LCD_FormatPut(buf, size, &n, ' ');
+  }
+
+  buf[n] = '\0';
+  return n;
+}
+/*******************************************************************************
+* Function Name  : LCD_Sprintf
+* Description    : format a string like LCD_Printf() without drawing it, e.g.
+                   for LCD_TextGlyphs() and the tile map
+* Input          : buf -- destination, always zero terminated
+                   size -- bytes in buf
+                   fmt -- format string, see LCD_Format()
+* Output         : None
+* Return         : characters written
+*******************************************************************************/
+unsigned char LCD_Sprintf(char *buf, unsigned char size, const char *fmt, ...)
+{
+  va_list args;
+  unsigned char n;
+
+  va_start(args, fmt);
+  n = LCD_Format(buf, size, fmt, args);
+  va_end(args);
+  return n;
+}
+/*******************************************************************************
+* Function Name  : LCD_Printf
+* Description    : format a string and draw it with LCD_DrawText()
+* Input          : Xpage -- postion of page
+                   YCol -- postion of colomn, LCD_TEXT_CENTER or LCD_TEXT_RIGHT
+                   fmt -- format string, see LCD_Format(); the output is
+                          cut off at LCD_TEXT_MAX characters
+* Output         : None
+* Return         : 0 -- failure
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_Printf(unsigned char Xpage, unsigned char YCol, const char *fmt, ...)
+{
+  char text[LCD_TEXT_MAX + 1];
+  va_list args;
+
+  va_start(args, fmt);
+  LCD_Format(text, sizeof(text), fmt, args);
+  va_end(args);
+  return LCD_DrawText(Xpage, YCol, text);
+}
+/*******************************************************************************
+* Function Name  : LCD_SmallGlyph
+* Description    : HUD font glyph of a character, ' ' for the ones without
+* Input          : c -- character
+* Output         : None
+* Return         : glyph in LCD_SmallFont[]
+*******************************************************************************/
+static inline const LCD_SmallGlyphTypeDef *LCD_SmallGlyph(char c)
+{
+  unsigned char ch = (unsigned char)c;
+
+  if (ch < LCD_ASCII_FIRST || ch > LCD_ASCII_LAST)
+    ch = ' ';
+  return &LCD_SmallFont[ch - LCD_ASCII_FIRST];
+}
+/*******************************************************************************
+* Function Name  : LCD_SmallTextWidth
+* Description    : width of a string in the proportional HUD font, the blank
+                   columns between the glyphs included
+* Input          : s -- zero terminated string
+* Output         : None
+* Return         : pixels
+*******************************************************************************/
+unsigned int LCD_SmallTextWidth(const char *s)
+{
+  unsigned int width = 0;
+
+  for (; *s; s++)
+    width += LCD_SmallGlyph(*s)->width + 1;
+  return width ? width - 1 : 0;
+}
+/*******************************************************************************
+* Function Name  : LCD_DrawSmallText
+* Description    : draw an ASCII string in the proportional HUD font into one
+                   page of the framebuffer. Glyph and gap columns replace the
+                   whole page byte, so the text needs no clearing underneath
+                   and goes out as a single partial-page run
+* Input          : Xpage -- postion of page
+                   YCol -- postion of colomn, or LCD_TEXT_CENTER to centre the
+                           string, LCD_TEXT_RIGHT to end it at the right edge
+                   s -- zero terminated string, cut off at the right edge
+* Output         : None
+* Return         : 0 -- failure
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawSmallText(unsigned char Xpage, unsigned char YCol, const char *s)
+{
+  const LCD_SmallGlyphTypeDef *glyph;
+  const unsigned char *src;
+  unsigned char *dst;
+  unsigned int width = LCD_SmallTextWidth(s);
+  unsigned char col, i;
+
+  if (width == 0 || Xpage >= LCD_PAGES)
+    return 0;
+  if (YCol == LCD_TEXT_CENTER)
+    YCol = (width < LCD_WIDTH) ? (LCD_WIDTH - width) / 2 : 0;
+  else if (YCol == LCD_TEXT_RIGHT)
+    YCol = (width < LCD_WIDTH) ? LCD_WIDTH - width : 0;
+  else if (YCol >= LCD_WIDTH)
+    return 0;
+
+  dst = &LCD_FrameBuffer[Xpage][YCol];
+  for (col = YCol; *s && col < LCD_WIDTH; s++)
+  {
+    // one blank column in front of every glyph but the first
+    if (col != YCol)
+    {
+      *dst++ = 0;
+      col++;
+    }
+    glyph = LCD_SmallGlyph(*s);
+    src = &LCD_SmallFontData[glyph->offset];
+    for (i = 0; i < glyph->width && col < LCD_WIDTH; i++, col++)
+      *dst++ = *src++;
+  }
+  LCD_MarkDirty(Xpage, YCol, col - 1);
+  return 1;
+}
+/*******************************************************************************
+* Function Name  : LCD_SmallPrintf
+* Description    : format a string and draw it with LCD_DrawSmallText()
+* Input          : Xpage -- postion of page
+                   YCol -- postion of colomn, LCD_TEXT_CENTER or LCD_TEXT_RIGHT
+                   fmt -- format string, see LCD_Format()
+* Output         : None
+* Return         : 0 -- failure
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_SmallPrintf(unsigned char Xpage, unsigned char YCol, const char *fmt, ...)
+{
+  char text[LCD_WIDTH / 2 + 1];  // the narrowest glyph takes 2 columns
+  va_list args;
+
+  va_start(args, fmt);
+  LCD_Format(text, sizeof(text), fmt, args);
+  va_end(args);
+  return LCD_DrawSmallText(Xpage, YCol, text);
+}
+/*******************************************************************************
+* Function Name  : LCD_BlitByte
+* Description    : combine one shifted sprite byte with a framebuffer byte
+* Input          : dst -- framebuffer byte
+                   src -- sprite pixels, already limited to the mask
+                   mask -- pixels owned by the sprite
+                   mode -- raster operation
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static inline void LCD_BlitByte(unsigned char *dst, unsigned char src, unsigned char mask, LCD_BlitModeTypeDef mode)
+{
+  switch (mode)
+  {
+    case LCD_BLIT_COPY:   *dst = (*dst & ~mask) | src; break;
+    case LCD_BLIT_OR:     *dst |= src;                 break;
+    case LCD_BLIT_ANDNOT: *dst &= ~src;                break;
+    case LCD_BLIT_XOR:    *dst ^= src;                 break;
+    case LCD_BLIT_INVERT: *dst = (*dst & ~mask) | (src ^ mask); break;
+  }
+}
+/*******************************************************************************
+* Function Name  : LCD_Blit
+* Description    : draw a sprite at any pixel position into the framebuffer
+                   Every sprite byte is split across two framebuffer pages:
+                   the low part shifted down into the top page, the rest into
+                   the page below. Columns and pages off screen are clipped
+* Input          : x -- column of the left edge (may be negative)
+                   y -- pixel row of the top edge (may be negative)
+                   image -- sprite bytes, pages rows of width bytes each,
+                            bit 0 is the top pixel (ChineseTable layout)
+                   mask -- same layout as image, 1 = pixel belongs to the
+                           sprite; NULL treats the whole rectangle as sprite
+                   width -- sprite width in columns
+                   pages -- sprite height in pages of 8 rows
+                   mode -- raster operation, see LCD_BlitModeTypeDef
+* Output         : None
+* Return         : 0 -- failure (completely off screen)
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_Blit(int x, int y, const unsigned char *image, const unsigned char *mask,
+                       unsigned char width, unsigned char pages, LCD_BlitModeTypeDef mode)
+{
+  int page, first, last, i;
+  unsigned char p, shift, src, msk;
+  const unsigned char *img, *m;
+
+  // clip columns
+  first = (x < 0) ? -x : 0;
+  last = (x + width > LCD_WIDTH) ? LCD_WIDTH - x : width;
+  if (first >= last || y >= LCD_HEIGHT || y + 8*pages <= 0)
+    return 0;
+
+  // floor division, so sprites can hang off the top edge
+  page = (y >= 0) ? y / 8 : -((7 - y) / 8);
+  shift = y - page * 8;
+
+  for (p = 0; p < pages; p++, page++)
+  {
+    img = image + p * width;
+    m = mask ? mask + p * width : NULL;
+
+    // low part of the sprite page lands in framebuffer page
+    if (page >= 0 && page < LCD_PAGES)
+    {
+      for (i = first; i < last; i++)
+      {
+        msk = (m ? m[i] : 0xff) << shift;
+        src = (img[i] << shift) & msk;
+        LCD_BlitByte(&LCD_FrameBuffer[page][x + i], src, msk, mode);
+      }
+      LCD_MarkDirty(page, x + first, x + last - 1);
+    }
+
+    // high part spills into the page below
+    if (shift && page + 1 >= 0 && page + 1 < LCD_PAGES)
+    {
+      for (i = first; i < last; i++)
+      {
+        msk = (m ? m[i] : 0xff) >> (8 - shift);
+        src = (img[i] >> (8 - shift)) & msk;
+        LCD_BlitByte(&LCD_FrameBuffer[page + 1][x + i], src, msk, mode);
+      }
+      LCD_MarkDirty(page + 1, x + first, x + last - 1);
+    }
+  }
+  return 1;
+}
+/*******************************************************************************
+* Function Name  : LCD_BlitString
+* Description    : blit a row of 8x16 glyphs from ChineseTable[] at any pixel
+                   position, e.g. the two halves of a 16x16 sprite
+* Input          : x -- column of the left edge (may be negative)
+                   y -- pixel row of the top edge (may be negative)
+                   c -- glyph offsets in the ChineseTable[]
+                   length -- number of glyphs
+                   mode -- raster operation, see LCD_BlitModeTypeDef
+* Output         : None
+* Return         : 0 -- failure (completely off screen)
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_BlitString(int x, int y, const unsigned char *c, unsigned char length, LCD_BlitModeTypeDef mode)
+{
+  unsigned char n, drawn = 0;
+
+  for (n = 0; n < length; n++)
+    drawn |= LCD_Blit(x + 8*n, y, ChineseTable[c[n]], NULL, 8, 2, mode);
+  return drawn;
+}
+#if LCD_SHIFT_CACHE && LCD_SHIFT_FRAMES > 0
+/*******************************************************************************
+* Function Name  : LCD_ShiftCacheInit
+* Description    : fill LCD_ShiftCache[] with every preshift sprite frame moved
+                   down by 1 to 7 rows: column bits 0-15 of the two glyph
+                   pages become bits shift to shift + 15 over three pages
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_ShiftCacheInit(void)
+{
+  const LCD_SpriteTypeDef *s;
+  const unsigned char *glyphs, *g;
+  unsigned char id, frame, shift, col;
+  unsigned long bits;
+
+  for (id = 0; id < SPRITE_COUNT; id++)
+  {
+    s = &LCD_Sprites[id];
+    if (s->shifted == LCD_SPRITE_NOT_SHIFTED)
+      continue;
+    for (frame = 0; frame < s->frames; frame++)
+    {
+      glyphs = LCD_SpriteFrame((LCD_SpriteIdTypeDef)id, frame);
+      for (col = 0; col < s->width; col++)
+      {
+        g = ChineseTable[glyphs[col / 8]];
+        for (shift = 1; shift < 8; shift++)
+        {
+          bits = (unsigned long)(g[col % 8] | (g[8 + col % 8] << 8)) << shift;
+          LCD_ShiftCache[s->shifted + frame][shift - 1][0][col] = bits;
+          LCD_ShiftCache[s->shifted + frame][shift - 1][1][col] = bits >> 8;
+          LCD_ShiftCache[s->shifted + frame][shift - 1][2][col] = bits >> 16;
+        }
+      }
+    }
+  }
+}
+/*******************************************************************************
+* Function Name  : LCD_BlitShifted
+* Description    : blit a pre-shifted sprite frame: three pages of bytes that
+                   already sit at their rows, copied under the page masks of
+                   the shift without shifting a single column
+* Input          : x -- column of the left edge (may be negative)
+                   y -- pixel row of the top edge, not on a page boundary
+                   data -- the frame from LCD_ShiftCache[] for y & 7
+                   width -- sprite width in columns
+                   mode -- raster operation, see LCD_BlitModeTypeDef
+* Output         : None
+* Return         : 0 -- failure (completely off screen)
+                   1 -- success
+*******************************************************************************/
+static unsigned char LCD_BlitShifted(int x, int y, const unsigned char (*data)[LCD_SHIFT_WIDTH],
+                                     unsigned char width, LCD_BlitModeTypeDef mode)
+{
+  int page, first, last, i;
+  unsigned char p, shift, msk;
+  unsigned char *dst;
+
+  first = (x < 0) ? -x : 0;
+  last = (x + width > LCD_WIDTH) ? LCD_WIDTH - x : width;
+  if (first >= last || y >= LCD_HEIGHT || y + 16 <= 0)
+    return 0;
+
+  page = (y >= 0) ? y / 8 : -((7 - y) / 8);
+  shift = y - page * 8;
+
+  for (p = 0; p < 3; p++, page++)
+  {
+    if (page < 0 || page >= LCD_PAGES)
+      continue;
+    msk = (p == 0) ? 0xFF << shift : (p == 1) ? 0xFF : 0xFF >> (8 - shift);
+    dst = &LCD_FrameBuffer[page][x];
+    for (i = first; i < last; i++)
+      LCD_BlitByte(&dst[i], data[p][i], msk, mode);
+    LCD_MarkDirty(page, x + first, x + last - 1);
+  }
+  return 1;
+}
+#endif
+/*******************************************************************************
+* Function Name  : LCD_SpriteFrame
+* Description    : glyphs of one frame of a sprite, for LCD_BlitString(),
+                   LCD_DrawString() or LCD_TileSetString()
+* Input          : id -- sprite, see Tools/assets/sprites.txt
+                   frame -- animation frame, wraps around
+* Output         : None
+* Return         : the (width + 7) / 8 glyph offsets of the frame
+*******************************************************************************/
+const unsigned char *LCD_SpriteFrame(LCD_SpriteIdTypeDef id, unsigned char frame)
+{
+  const LCD_SpriteTypeDef *s = &LCD_Sprites[id];
+
+  return &LCD_SpriteGlyphs[s->glyphs + (frame % s->frames) * ((s->width + 7) / 8)];
+}
+/*******************************************************************************
+* Function Name  : LCD_BlitSprite
+* Description    : blit one frame of a sprite at any pixel position
+* Input          : x -- column of the left edge (may be negative)
+                   y -- pixel row of the top edge (may be negative)
+                   id -- sprite, see Tools/assets/sprites.txt
+                   frame -- animation frame, wraps around
+                   mode -- raster operation, see LCD_BlitModeTypeDef
+* Output         : None
+* Return         : 0 -- failure (completely off screen)
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_BlitSprite(int x, int y, LCD_SpriteIdTypeDef id, unsigned char frame, LCD_BlitModeTypeDef mode)
+{
+#if LCD_SHIFT_CACHE && LCD_SHIFT_FRAMES > 0
+  const LCD_SpriteTypeDef *s = &LCD_Sprites[id];
+
+  if (s->shifted != LCD_SPRITE_NOT_SHIFTED && (y & 7))
+    return LCD_BlitShifted(x, y, LCD_ShiftCache[s->shifted + frame % s->frames][(y & 7) - 1], s->width, mode);
+#endif
+  return LCD_BlitString(x, y, LCD_SpriteFrame(id, frame), (LCD_Sprites[id].width + 7) / 8, mode);
+}
+/*******************************************************************************
+* Function Name  : LCD_DrawImage
+* Description    : draw an image at a page boundary. Run-length encoded images
+                   are decoded while drawing, straight into the framebuffer:
+                   a control byte c below 0x80 is followed by c + 1 literal
+                   bytes, c from 0x80 repeats the next byte (c & 0x7F) + 2
+                   times, runs go on across page ends
+* Input          : x -- column of the left edge (may be negative)
+                   page -- top page (0-7)
+                   id -- image, see Tools/assets/
+                   mode -- raster operation, see LCD_BlitModeTypeDef
+* Output         : None
+* Return         : 0 -- failure (completely off screen)
+                   1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawImage(int x, unsigned char page, LCD_ImageIdTypeDef id, LCD_BlitModeTypeDef mode)
+{
+  const LCD_ImageTypeDef *image = &LCD_Images[id];
+  const unsigned char *src = image->data;
+  unsigned char count = 0, repeat = 0, value = 0;
+  int first, last, col;
+  unsigned char p;
+
+  first = x < 0 ? -x : 0;
+  last = x + image->width > LCD_WIDTH ? LCD_WIDTH - 1 - x : image->width - 1;
+  if (first > last || page >= LCD_PAGES)
+    return 0;
+
+  for (p = 0; p < image->pages; p++)
+  {
+    for (col = 0; col < image->width; col++)
+    {
+      if (!image->rle)
+        value = *src++;
+      else if (count > 0)
+      {
+        count--;
+        if (!repeat)
+          value = *src++;
+      }
+      else
+      {
+        // next control byte, its first byte is used right away
+        repeat = *src & 0x80;
+        count = repeat ? (*src++ & 0x7F) + 1 : *src++;
+        value = *src++;
+      }
+      if (col >= first && col <= last && page + p < LCD_PAGES)
+        LCD_BlitByte(&LCD_FrameBuffer[page + p][x + col], value, 0xFF, mode);
+    }
+    if (page + p < LCD_PAGES)
+      LCD_MarkDirty(page + p, x + first, x + last);
+  }
+  return 1;
+}
+/*******************************************************************************
+* Function Name  : reset_delay / power_delay
+* Description    : wait after software reset and between the power control
+                   steps, timed by SysTick so the wait does not depend on
+                   SYSCLK or optimisation level
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void reset_delay(void)
+{
+  HAL_Delay(1);
+}
+
+
+void power_delay(void)
+{
+  HAL_Delay(50);
+}
+
+
+/*******************************************************************************
+* Function Name  : STM3210E_LCD_Init
+* Description    : Initializes the LCD.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void STM3210E_LCD_Init(void)
+{  
+/* Configure the LCD Control pins --------------------------------------------*/
+  LCD_CtrlLinesConfig();
+
+/* Configure the FSMC Parallel interface -------------------------------------*/
+  LCD_FSMCConfig();
+
+/* Configure the DMA channel used by LCD_Flush -------------------------------*/
+  LCD_DMAConfig();
+  LCD_TileClear();
+  
+
+  LCD_WriteCommand(Display_Off); //
+  LCD_WriteCommand(LCD_Reset); //
+  reset_delay();
+  
+  LCD_WriteCommand(Set_LCD_Bias_9);
+  LCD_WriteCommand(Set_ADC_Normal);
+  LCD_WriteCommand(COM_Scan_Dir_Reverse);
+  LCD_WriteCommand(Set_Start_Line_X|0x0);
+  
+  LCD_WriteCommand(0x2c);
+  power_delay(); // 50ms requried
+  LCD_WriteCommand(0x2e);
+  power_delay(); // 50ms
+  LCD_WriteCommand(0x2f);
+  power_delay(); // 50ms
+  
+  LCD_WriteCommand(Set_Ref_Vol_Reg|0x05);
+  LCD_WriteCommand(Set_Ref_Vol_Mode);
+  LCD_WriteCommand(Set_Ref_Vol_Reg);
+  
+  LCD_Clear();
+  
+  LCD_WriteCommand(Set_Page_Addr_X|0x0);
+  LCD_WriteCommand(Set_ColH_Addr_X|0x0);
+  LCD_WriteCommand(Set_ColL_Addr_X|0x0);
+ 
+  LCD_WriteCommand(Display_On); //
+}
+
+
+/*******************************************************************************
+* Function Name  : LCD_Clear
+* Description    : Clears all layers, the tile map and the hole LCD.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_Clear(void)
+{
+  LCD_ClearPages(0, LCD_PAGES - 1);
+  LCD_DiffSkip = 0;  // all of display RAM is known again
+
+  LCD_WriteCommand(Set_Start_Line_X|0x0); // start line
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ClearPages
+* Description    : clear pages first..last at once in the layers, the tile
+                   map, both buffers and display RAM. Display RAM is filled
+                   by DMA from a single zero byte, one address setup and 128
+                   bytes per page, while the CPU clears the RAM copies of the
+                   same page. Dirty runs on these pages are dropped, the
+                   other pages are left as they are. Waits for a running
+                   flush first and returns when the pages are blank
+* Input          : first, last -- page range, 0-7
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_ClearPages(unsigned char first, unsigned char last)
+{
+  static const unsigned char zero = 0x00;
+  unsigned char page, cell, i, n;
+
+  if (last >= LCD_PAGES)
+    last = LCD_PAGES - 1;
+  if (first > last)
+    return;
+
+  LCD_FlushWait();
+  for (page = first; page <= last; page++)
+  {
+    LCD_WriteCommand(Set_Page_Addr_X|page);
+    LCD_WriteCommand(Set_ColH_Addr_X|0x0);
+    LCD_WriteCommand(Set_ColL_Addr_X|0x0);
+    LCD_DMAFillStart(&zero, LCD_WIDTH);
+
+    for (n = 0; n < LCD_LAYER_COUNT; n++)
+      memset(LCD_Layers[n][page], 0x0, LCD_WIDTH);
+    memset(LCD_BackBuffer[page], 0x0, LCD_WIDTH);
+    memset(LCD_FrontBuffer[page], 0x0, LCD_WIDTH);
+    for (cell = 0; cell < LCD_TILE_COLS; cell++)
+      LCD_TileMap[page][cell] = LCD_TILE_NONE;
+    LCD_TileDirty[page] = 0;
+    LCD_TileUsed[page] = 0;
+
+    LCD_DMAFillWait();
+  }
+
+  for (i = n = 0; i < LCD_RunCount; i++)
+    if (LCD_Runs[i].page < first || LCD_Runs[i].page > last)
+      LCD_Runs[n++] = LCD_Runs[i];
+  LCD_RunCount = n;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ClearBuffer
+* Description    : clear all layers and the tile map without touching the
+                   bus and mark every page dirty; the next LCD_SwapBuffers()
+                   diffs the blank frame (plus whatever is drawn on it
+                   meanwhile) against the LCD and only sends what changed
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_ClearBuffer(void)
+{
+  unsigned char page;
+
+  memset(LCD_Layers, 0x0, sizeof(LCD_Layers));
+  LCD_TileClear();
+  for (page = 0; page < LCD_PAGES; page++)
+    LCD_MarkSpan(page, 0, LCD_WIDTH - 1);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_Reset_Cursor
+* Description    : set the cursor at the middle of LCD --> at page 3&4 column (64-8)~(64+8)
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_Reset_Cursor(void)
+{
+  // page 3&4, column 0x38~0x47
+  memset(&LCD_FrameBuffer[3][0x38], 0xff, 16);
+  memset(&LCD_FrameBuffer[4][0x38], 0xff, 16);
+  LCD_MarkDirty(3, 0x38, 0x47);
+  LCD_MarkDirty(4, 0x38, 0x47);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_Clr_Cursor
+* Description    : clear the cursor at any location --> but only need to 
+                   clear the data in ram at at page 3&4 column (64-8)~(64+8)
+                   as far as where it looks on LCD depends on the y-position
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+signed char x_p;
+void LCD_Clr_Cursor(signed char x)
+{
+  unsigned char col_no; //0x38+x
+  col_no=0x40+(x_p/8 -1)*8; //0x38+x
+  if (col_no > LCD_WIDTH - 16)
+    return;
+
+  //page 3&4, write 16 column
+  memset(&LCD_FrameBuffer[3][col_no], 0x00, 16);
+  memset(&LCD_FrameBuffer[4][col_no], 0x00, 16);
+  LCD_MarkDirty(3, col_no, col_no + 15);
+  LCD_MarkDirty(4, col_no, col_no + 15);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_PowerOn
+* Description    : always handle cursor data of ram with page=3/4 no matter 
+                   what is the y-postion and different column corresponding 
+                   to diff x_postion
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_Set_Cursor(signed char x)
+{
+  unsigned char col_no; //0x38+x
+  col_no=0x40+(x/8 -1)*8; //0x38+x
+  if (col_no > LCD_WIDTH - 16)
+    return;
+
+  //page 3&4, column diff with x-postion
+  memset(&LCD_FrameBuffer[3][col_no], 0xff, 16);
+  memset(&LCD_FrameBuffer[4][col_no], 0xff, 16);
+  LCD_MarkDirty(3, col_no, col_no + 15);
+  LCD_MarkDirty(4, col_no, col_no + 15);
+}
+
+
+/*******************************************************************************
+* Function Name  : LCD_PowerOn
+* Description    : Power on the LCD.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_PowerOn(void)
+{
+  LCD_WriteCommand(0x2c);
+  LCD_WriteCommand(0x2e);
+  LCD_WriteCommand(0x2f);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DisplayOn
+* Description    : Enables the Display.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_DisplayOn(void)
+{
+  LCD_WriteCommand(Display_On);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DisplayOff
+* Description    : Disables the Display.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_DisplayOff(void)
+{
+  LCD_WriteCommand(Display_Off);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_CtrlLinesConfig
+* Description    : Configures LCD Control lines (FSMC Pins) in alternate function
+                   Push-Pull mode.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_CtrlLinesConfig(void)
+{
+	__HAL_RCC_GPIOA_CLK_ENABLE();
+	__HAL_RCC_GPIOB_CLK_ENABLE();
+	__HAL_RCC_GPIOC_CLK_ENABLE();
+	__HAL_RCC_GPIOD_CLK_ENABLE();
+	__HAL_RCC_GPIOE_CLK_ENABLE();
+	__HAL_RCC_GPIOF_CLK_ENABLE();
+	__HAL_RCC_GPIOG_CLK_ENABLE();
+	
+	__FSMC_CLK_DISABLE();
+	HAL_GPIO_DeInit(GPIOF, GPIO_PIN_0);
+
+  HAL_GPIO_DeInit(GPIOE, GPIO_PIN_7|GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10 
+                          |GPIO_PIN_11|GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14 
+                          |GPIO_PIN_15);
+
+  HAL_GPIO_DeInit(GPIOD, GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10|GPIO_PIN_14 
+                          |GPIO_PIN_15|GPIO_PIN_0|GPIO_PIN_1|GPIO_PIN_4 
+                          |GPIO_PIN_5);
+
+  HAL_GPIO_DeInit(GPIOG, GPIO_PIN_12);
+	
+	GPIO_InitTypeDef GPIO_InitStruct;
+	__FSMC_CLK_ENABLE();
+	
+	GPIO_InitStruct.Pin = GPIO_PIN_0;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
+  HAL_GPIO_Init(GPIOF, &GPIO_InitStruct);
+
+  GPIO_InitStruct.Pin = GPIO_PIN_7|GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10 
+                          |GPIO_PIN_11|GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14 
+                          |GPIO_PIN_15;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
+  HAL_GPIO_Init(GPIOE, &GPIO_InitStruct);
+
+  GPIO_InitStruct.Pin = GPIO_PIN_8|GPIO_PIN_9|GPIO_PIN_10|GPIO_PIN_14 
+                          |GPIO_PIN_15|GPIO_PIN_0|GPIO_PIN_1|GPIO_PIN_4 
+                          |GPIO_PIN_5;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
+  HAL_GPIO_Init(GPIOD, &GPIO_InitStruct);
+
+  GPIO_InitStruct.Pin = GPIO_PIN_12;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
+  HAL_GPIO_Init(GPIOG, &GPIO_InitStruct);
+}
+
+static unsigned long LCD_BusCycles;  // HCLK cycles per FSMC access, set by LCD_FSMCConfig()
+
+/*******************************************************************************
+* Function Name  : LCD_NsToCycles
+* Description    : convert a minimum time in ns to HCLK cycles, rounded up
+* Input          : ns -- time in nanoseconds
+                   hclk -- HCLK frequency in Hz
+* Output         : None
+* Return         : number of HCLK cycles covering at least ns
+*******************************************************************************/
+static unsigned long LCD_NsToCycles(unsigned long ns, unsigned long hclk)
+{
+  // hclk/1000 keeps the product inside 32 bits up to 72MHz
+  return (ns * (hclk / 1000) + 999999) / 1000000;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_GetBusCycles
+* Description    : HCLK cycles taken by one LCD bus access with the current
+                   FSMC timing, HCLK / this value is the highest byte rate the
+                   bus can reach
+* Input          : None
+* Output         : None
+* Return         : cycles per access
+*******************************************************************************/
+unsigned long LCD_GetBusCycles(void)
+{
+  return LCD_BusCycles;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FSMCConfig
+* Description    : Configures the Parallel interface (FSMC) for LCD(Parallel mode)
+                   The access timing is derived from the current HCLK and the
+                   ST7565 8080 bus limits, call again after changing SYSCLK
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_FSMCConfig(void)
+{ 
+  //FSMC_NORSRAMInitTypeDef  FSMC_NORSRAMInitStructure;
+  //FSMC_NORSRAMTimingInitTypeDef  p;
+	SRAM_HandleTypeDef hsram4;
+	FSMC_NORSRAM_TimingTypeDef p;
+  unsigned long hclk = HAL_RCC_GetHCLKFreq();
+  unsigned long datast, addset, cycle;
+
+/*-- FSMC Timing -------------------------------------------------------------*/
+  /* Mode 1 access: /WR (/RD) is held low for DATAST HCLK cycles and high for
+     ADDSET+1 cycles, one access takes ADDSET+DATAST+1 cycles in total */
+  datast = LCD_NsToCycles(LCD_T_RD_LOW_NS > LCD_T_WR_LOW_NS ? LCD_T_RD_LOW_NS : LCD_T_WR_LOW_NS, hclk);
+  if (datast < 1)   datast = 1;
+  if (datast > 255) datast = 255;
+
+  addset = LCD_NsToCycles(LCD_T_HIGH_NS, hclk);
+  addset = (addset > 0) ? addset - 1 : 0;
+  cycle = LCD_NsToCycles(LCD_T_CYC_NS, hclk);
+  if (addset + datast + 1 < cycle)
+    addset = cycle - datast - 1;
+  if (addset > 15)  addset = 15;
+
+  LCD_BusCycles = addset + datast + 1;
+
+/*-- FSMC Configuration ------------------------------------------------------*/
+/*----------------------- SRAM Bank 4 ----------------------------------------*/
+  /* FSMC_Bank1_NORSRAM4 configuration */
+  p.AddressSetupTime = addset;
+  p.AddressHoldTime = 1;
+  p.DataSetupTime = datast;
+  p.BusTurnAroundDuration = 0;
+  p.CLKDivision = 0;
+  p.DataLatency = 1;
+  p.AccessMode = (unsigned long)0x00000000;
+
+	hsram4.Instance = FSMC_NORSRAM_DEVICE;
+  hsram4.Extended = FSMC_NORSRAM_EXTENDED_DEVICE;
+  /* Color LCD configuration ------------------------------------
+     LCD configured as follow:
+        - Data/Address MUX = Disable
+        - Memory Type = SRAM
+        - Data Width = 16bit
+        - Write Operation = Enable
+        - Extended Mode = Enable
+        - Asynchronous Wait = Disable */
+  //FSMC_NORSRAMInitStructure.FSMC_Bank = FSMC_Bank1_NORSRAM4;
+	hsram4.Init.NSBank = FSMC_NORSRAM_BANK4;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_DataAddressMux = FSMC_DataAddressMux_Disable;
+	hsram4.Init.DataAddressMux = FSMC_DATA_ADDRESS_MUX_DISABLE;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_MemoryType = FSMC_MemoryType_SRAM;
+	hsram4.Init.MemoryType = FSMC_MEMORY_TYPE_SRAM;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_MemoryDataWidth = FSMC_MemoryDataWidth_8b;
+	hsram4.Init.MemoryDataWidth = FSMC_NORSRAM_MEM_BUS_WIDTH_8;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_BurstAccessMode = FSMC_BurstAccessMode_Disable;
+	hsram4.Init.BurstAccessMode = FSMC_BURST_ACCESS_MODE_DISABLE;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_WaitSignalPolarity = FSMC_WaitSignalPolarity_Low;
+	hsram4.Init.WaitSignalPolarity = FSMC_WAIT_SIGNAL_POLARITY_LOW;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_WrapMode = FSMC_WrapMode_Disable;
+	hsram4.Init.WrapMode = FSMC_WRAP_MODE_DISABLE;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_WaitSignalActive = FSMC_WaitSignalActive_BeforeWaitState;
+	hsram4.Init.WaitSignalActive = FSMC_WAIT_TIMING_BEFORE_WS;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_WriteOperation = FSMC_WriteOperation_Enable;
+	hsram4.Init.WriteOperation = FSMC_WRITE_OPERATION_ENABLE;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_WaitSignal = FSMC_WaitSignal_Disable;
+	hsram4.Init.WaitSignal = FSMC_WAIT_SIGNAL_DISABLE;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_ExtendedMode = FSMC_ExtendedMode_Disable;
+	hsram4.Init.ExtendedMode = FSMC_EXTENDED_MODE_DISABLE;
+	
+  //FSMC_NORSRAMInitStructure.FSMC_WriteBurst = FSMC_WriteBurst_Disable;
+	hsram4.Init.WriteBurst = FSMC_WRITE_BURST_DISABLE;
+	
+	hsram4.Init.AsynchronousWait = FSMC_ASYNCHRONOUS_WAIT_DISABLE;
+  //FSMC_NORSRAMInitStructure.FSMC_ReadWriteTimingStruct = &p;
+  //FSMC_NORSRAMInitStructure.FSMC_WriteTimingStruct = &p;
+	
+	HAL_SRAM_Init(&hsram4, &p, NULL);
+  //FSMC_NORSRAMInit(&FSMC_NORSRAMInitStructure);  
+	__HAL_AFIO_FSMCNADV_DISCONNECTED();
+  /* BANK 4 (of NOR/SRAM Bank 1~4) is enabled */
+	
+  //FSMC_NORSRAMCmd(FSMC_Bank1_NORSRAM4, ENABLE);
+}
+/*******************************************************************************
+* Pixel kernels
+* The primitives below change the framebuffer with byte masks only, nothing
+* is read back from the controller. Every primitive marks its bounding
+* rectangle dirty once at the end instead of once per pixel.
+*******************************************************************************/
+/*******************************************************************************
+* Function Name  : LCD_PutPixel
+* Description    : set or clear one framebuffer pixel, without dirty marking
+* Input          : x -- column, y -- row, pixels off screen are ignored
+                   state -- 1: set, 0: clear
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static inline void LCD_PutPixel(signed short x, signed short y, unsigned char state)
+{
+  if (x < 0 || x >= LCD_WIDTH || y < 0 || y >= LCD_HEIGHT)
+    return;
+
+  if (state)
+    LCD_FrameBuffer[y >> 3][x] |= (1 << (y & 7));
+  else
+    LCD_FrameBuffer[y >> 3][x] &= ~(1 << (y & 7));
+}
+/*******************************************************************************
+* Function Name  : LCD_HSpan
+* Description    : set or clear a horizontal run of pixels: one OR/AND-mask
+                   write per column, without dirty marking
+* Input          : x1, x2 -- first and last column (x1 <= x2), clipped
+                   y -- row, ignored when off screen
+                   state -- 1: set, 0: clear
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_HSpan(signed short x1, signed short x2, signed short y, unsigned char state)
+{
+  unsigned char *p, *end;
+  unsigned char bit;
+
+  if (y < 0 || y >= LCD_HEIGHT)
+    return;
+  if (x1 < 0) x1 = 0;
+  if (x2 >= LCD_WIDTH) x2 = LCD_WIDTH - 1;
+  if (x1 > x2)
+    return;
+
+  bit = 1 << (y & 7);
+  p = &LCD_FrameBuffer[y >> 3][x1];
+  end = &LCD_FrameBuffer[y >> 3][x2];
+
+  if (state)
+    for (; p <= end; p++) *p |= bit;
+  else
+    for (bit = ~bit; p <= end; p++) *p &= bit;
+}
+/*******************************************************************************
+* Function Name  : LCD_VSpan
+* Description    : set or clear a vertical run of pixels: whole-byte stores
+                   for the full pages, masked writes only at the two end
+                   pages, without dirty marking
+* Input          : x -- column, ignored when off screen
+                   y1, y2 -- first and last row (y1 <= y2), clipped
+                   state -- 1: set, 0: clear
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_VSpan(signed short x, signed short y1, signed short y2, unsigned char state)
+{
+  unsigned char page, page_end, top, bottom;
+
+  if (x < 0 || x >= LCD_WIDTH)
+    return;
+  if (y1 < 0) y1 = 0;
+  if (y2 >= LCD_HEIGHT) y2 = LCD_HEIGHT - 1;
+  if (y1 > y2)
+    return;
+
+  page = y1 >> 3;
+  page_end = y2 >> 3;
+  top = 0xFF << (y1 & 7);            // rows y1.. of the first page
+  bottom = 0xFF >> (7 - (y2 & 7));   // rows ..y2 of the last page
+
+  if (page == page_end)
+    top &= bottom;
+
+  if (state)
+    LCD_FrameBuffer[page][x] |= top;
+  else
+    LCD_FrameBuffer[page][x] &= ~top;
+
+  if (page == page_end)
+    return;
+
+  for (page++; page < page_end; page++)
+    LCD_FrameBuffer[page][x] = state ? 0xFF : 0x00;
+
+  if (state)
+    LCD_FrameBuffer[page_end][x] |= bottom;
+  else
+    LCD_FrameBuffer[page_end][x] &= ~bottom;
+}
+/*******************************************************************************
+* Function Name  : LCD_FillBlock
+* Description    : set or clear a rectangle as one vertical span per column,
+                   without dirty marking
+* Input          : x1, y1 -- top-left corner, x2, y2 -- bottom-right corner,
+                   ordered and inside the screen
+                   state -- 1: set, 0: clear
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_FillBlock(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state)
+{
+  unsigned char x;
+
+  for (x = x1; x <= x2; x++)
+    LCD_VSpan(x, y1, y2, state);
+}
+/*******************************************************************************
+* Function Name  : LCD_MarkDirtyRect
+* Description    : mark the pages and columns of a rectangle dirty, clipped
+                   to the screen
+* Input          : x1, y1 -- top-left corner, x2, y2 -- bottom-right corner
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_MarkDirtyRect(signed short x1, signed short y1, signed short x2, signed short y2)
+{
+  unsigned char page;
+
+  if (x1 < 0) x1 = 0;
+  if (y1 < 0) y1 = 0;
+  if (x2 >= LCD_WIDTH)  x2 = LCD_WIDTH - 1;
+  if (y2 >= LCD_HEIGHT) y2 = LCD_HEIGHT - 1;
+  if (x1 > x2 || y1 > y2)
+    return;
+
+  for (page = y1 / 8; page <= y2 / 8; page++)
+    LCD_MarkDirty(page, x1, x2);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_SetPixel
+* Description    : Set or clear a specific pixel at (x, y) coordinate
+* Input          : x -- x coordinate (0-127, column position)
+                   y -- y coordinate (0-63, row position)
+                   state -- 1: set pixel (turn on), 0: clear pixel (turn off)
+* Output         : None
+* Return         : 0 -- failure (out of bounds)
+                   1 -- success
+* Note           : LCD is organized in 8 pages (0-7), each page contains 8 rows
+                   y/8 gives the page number, y%8 gives the bit position in that page
+                   Only the framebuffer is changed, call LCD_Flush() to display
+*******************************************************************************/
+unsigned char LCD_SetPixel(unsigned char x, unsigned char y, unsigned char state)
+{
+  // Boundary check
+  if (x >= 128 || y >= 64)
+    return 0;
+  
+  LCD_PutPixel(x, y, state);
+  LCD_MarkDirty(y / 8, x, x);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DrawLine
+* Description    : Draw a horizontal line from (x1, y) to (x2, y)
+                   One horizontal span, a masked byte per column
+* Input          : x1, x2 -- start and end x coordinates (0-127)
+                   y -- y coordinate (0-63)
+                   state -- 1: draw line, 0: erase line
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawLine(unsigned char x1, unsigned char x2, unsigned char y, unsigned char state)
+{
+  unsigned char start_x, end_x;
+  
+  if (y >= 64)
+    return 0;
+  
+  // Ensure x1 <= x2
+  if (x1 <= x2)
+  {
+    start_x = x1;
+    end_x = x2;
+  }
+  else
+  {
+    start_x = x2;
+    end_x = x1;
+  }
+  
+  if (start_x >= 128)
+    return 0;
+  if (end_x >= 128)
+    end_x = 127;
+  
+  LCD_HSpan(start_x, end_x, y, state);
+  LCD_MarkDirty(y / 8, start_x, end_x);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DrawRect
+* Description    : Draw a rectangle outline
+* Input          : x1, y1 -- top-left corner coordinates
+                   x2, y2 -- bottom-right corner coordinates
+                   state -- 1: draw, 0: erase
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawRect(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state)
+{
+  unsigned char temp;
+  
+  if (x1 >= 128 || x2 >= 128 || y1 >= 64 || y2 >= 64)
+    return 0;
+  
+  // Ensure proper ordering
+  if (x1 > x2) { temp = x1; x1 = x2; x2 = temp; }
+  if (y1 > y2) { temp = y1; y1 = y2; y2 = temp; }
+  
+  // Horizontal lines (top and bottom), then vertical lines (left and right)
+  LCD_HSpan(x1, x2, y1, state);
+  LCD_HSpan(x1, x2, y2, state);
+  LCD_VSpan(x1, y1, y2, state);
+  LCD_VSpan(x2, y1, y2, state);
+  LCD_MarkDirtyRect(x1, y1, x2, y2);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DrawCircle
+* Description    : Draw a circle outline using Bresenham's algorithm
+* Input          : xc, yc -- center coordinates
+                   radius -- circle radius
+                   state -- 1: draw, 0: erase
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawCircle(unsigned char xc, unsigned char yc, unsigned char radius, unsigned char state)
+{
+  signed short x = 0;
+  signed short y = radius;
+  signed short d = 3 - 2 * radius;
+  
+  // Boundary check
+  if (xc >= 128 || yc >= 64)
+    return 0;
+  
+  while (y >= x)
+  {
+    // Draw 8 symmetric points, LCD_PutPixel clips the ones off screen
+    LCD_PutPixel(xc + x, yc + y, state);
+    LCD_PutPixel(xc - x, yc + y, state);
+    LCD_PutPixel(xc + x, yc - y, state);
+    LCD_PutPixel(xc - x, yc - y, state);
+    LCD_PutPixel(xc + y, yc + x, state);
+    LCD_PutPixel(xc - y, yc + x, state);
+    LCD_PutPixel(xc + y, yc - x, state);
+    LCD_PutPixel(xc - y, yc - x, state);
+    
+    x++;
+    
+    if (d > 0)
+    {
+      y--;
+      d = d + 4 * (x - y) + 10;
+    }
+    else
+    {
+      d = d + 4 * x + 6;
+    }
+  }
+  
+  LCD_MarkDirtyRect(xc - radius, yc - radius, xc + radius, yc + radius);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FillCircle
+* Description    : Draw a filled circle
+                   Built from vertical spans, about one byte per 8 pixels
+* Input          : xc, yc -- center coordinates
+                   radius -- circle radius
+                   state -- 1: fill, 0: clear
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_FillCircle(unsigned char xc, unsigned char yc, unsigned char radius, unsigned char state)
+{
+  signed short dx;
+  signed short h = radius;
+  signed long r2 = (signed long)radius * radius + radius;  // rounds the edge like LCD_DrawCircle
+  
+  // Boundary check
+  if (xc >= 128 || yc >= 64)
+    return 0;
+  
+  // One vertical span per column, the half height shrinks as dx grows
+  for (dx = 0; dx <= radius; dx++)
+  {
+    while ((signed long)dx * dx + (signed long)h * h > r2)
+      h--;
+    
+    LCD_VSpan(xc + dx, yc - h, yc + h, state);
+    if (dx)
+      LCD_VSpan(xc - dx, yc - h, yc + h, state);
+  }
+  
+  LCD_MarkDirtyRect(xc - radius, yc - radius, xc + radius, yc + radius);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DrawVLine
+* Description    : Draw a vertical line
+                   One vertical span, whole bytes except at the end pages
+* Input          : x -- x coordinate
+                   y1, y2 -- start and end y coordinates
+                   state -- 1: draw, 0: erase
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawVLine(unsigned char x, unsigned char y1, unsigned char y2, unsigned char state)
+{
+  unsigned char start_y, end_y;
+  
+  if (x >= 128)
+    return 0;
+  
+  // Ensure y1 <= y2
+  if (y1 <= y2)
+  {
+    start_y = y1;
+    end_y = y2;
+  }
+  else
+  {
+    start_y = y2;
+    end_y = y1;
+  }
+  
+  if (start_y >= 64)
+    return 0;
+  if (end_y >= 64)
+    end_y = 63;
+  
+  LCD_VSpan(x, start_y, end_y, state);
+  LCD_MarkDirtyRect(x, start_y, x, end_y);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FillRect
+* Description    : Draw a filled rectangle
+* Input          : x1, y1 -- top-left corner coordinates
+                   x2, y2 -- bottom-right corner coordinates
+                   state -- 1: fill, 0: clear
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_FillRect(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state)
+{
+  unsigned char start_x, end_x, start_y, end_y;
+  
+  // Ensure proper ordering
+  if (x1 <= x2)
+  {
+    start_x = x1;
+    end_x = x2;
+  }
+  else
+  {
+    start_x = x2;
+    end_x = x1;
+  }
+  
+  if (y1 <= y2)
+  {
+    start_y = y1;
+    end_y = y2;
+  }
+  else
+  {
+    start_y = y2;
+    end_y = y1;
+  }
+  
+  // Boundary check
+  if (start_x >= 128 || start_y >= 64)
+    return 0;
+  
+  if (end_x >= 128) end_x = 127;
+  if (end_y >= 64) end_y = 63;
+  
+  // Fill rectangle one vertical span per column
+  LCD_FillBlock(start_x, start_y, end_x, end_y, state);
+  LCD_MarkDirtyRect(start_x, start_y, end_x, end_y);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DrawLineAngle
+* Description    : Draw a line at any angle using Bresenham's algorithm
+* Input          : x0, y0 -- start point coordinates
+                   x1, y1 -- end point coordinates
+                   state -- 1: draw, 0: erase
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawLineAngle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char state)
+{
+  signed short dx = x1 > x0 ? x1 - x0 : x0 - x1;
+  signed short dy = y1 > y0 ? y1 - y0 : y0 - y1;
+  signed short sx = x0 < x1 ? 1 : -1;
+  signed short sy = y0 < y1 ? 1 : -1;
+  signed short err = dx - dy;
+  signed short e2;
+  signed short cur_x = x0;
+  signed short cur_y = y0;
+  
+  while (1)
+  {
+    // Draw pixel, LCD_PutPixel clips it when off screen
+    LCD_PutPixel(cur_x, cur_y, state);
+    
+    // Check if we've reached the end
+    if (cur_x == x1 && cur_y == y1)
+      break;
+    
+    e2 = 2 * err;
+    
+    if (e2 > -dy)
+    {
+      err -= dy;
+      cur_x += sx;
+    }
+    
+    if (e2 < dx)
+    {
+      err += dx;
+      cur_y += sy;
+    }
+  }
+  
+  LCD_MarkDirtyRect(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_DrawTriangle
+* Description    : Draw a triangle outline
+* Input          : x0, y0, x1, y1, x2, y2 -- three vertex coordinates
+                   state -- 1: draw, 0: erase
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_DrawTriangle(unsigned char x0, unsigned char y0, 
+                                unsigned char x1, unsigned char y1,
+                                unsigned char x2, unsigned char y2, 
+                                unsigned char state)
+{
+  LCD_DrawLineAngle(x0, y0, x1, y1, state);
+  LCD_DrawLineAngle(x1, y1, x2, y2, state);
+  LCD_DrawLineAngle(x2, y2, x0, y0, state);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FillTriangle
+* Description    : Draw a filled triangle
+* Input          : x0, y0, x1, y1, x2, y2 -- three vertex coordinates
+                   state -- 1: fill, 0: clear
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+* Note           : Scans column by column and fills the rows between the
+                   two edges with one vertical span, so a page byte covers
+                   8 pixels at a time
+*******************************************************************************/
+unsigned char LCD_FillTriangle(unsigned char x0, unsigned char y0, 
+                                unsigned char x1, unsigned char y1,
+                                unsigned char x2, unsigned char y2, 
+                                unsigned char state)
+{
+  signed short a, b, x, last;
+  signed short dx01, dy01, dx02, dy02, dx12, dy12;
+  signed long sa = 0, sb = 0;
+  unsigned char temp;
+  
+  // Sort coordinates by X order (x0 <= x1 <= x2)
+  if (x0 > x1) {
+    temp = y0; y0 = y1; y1 = temp;
+    temp = x0; x0 = x1; x1 = temp;
+  }
+  if (x1 > x2) {
+    temp = y2; y2 = y1; y1 = temp;
+    temp = x2; x2 = x1; x1 = temp;
+  }
+  if (x0 > x1) {
+    temp = y0; y0 = y1; y1 = temp;
+    temp = x0; x0 = x1; x1 = temp;
+  }
+  
+  if (x0 == x2) // All on same column
+  {
+    a = b = y0;
+    if (y1 < a)      a = y1;
+    else if (y1 > b) b = y1;
+    if (y2 < a)      a = y2;
+    else if (y2 > b) b = y2;
+    return LCD_DrawVLine(x0, a, b, state);
+  }
+  
+  dx01 = x1 - x0;
+  dy01 = y1 - y0;
+  dx02 = x2 - x0;
+  dy02 = y2 - y0;
+  dx12 = x2 - x1;
+  dy12 = y2 - y1;
+  
+  // For left part of triangle, find column crossings
+  if (x1 == x2) last = x1;
+  else          last = x1 - 1;
+  
+  for (x = x0; x <= last; x++)
+  {
+    a = y0 + sa / dx01;
+    b = y0 + sb / dx02;
+    sa += dy01;
+    sb += dy02;
+    
+    if (a > b) { temp = a; a = b; b = temp; }
+    LCD_VSpan(x, a, b, state);
+  }
+  
+  // For right part of triangle
+  sa = (signed long)dy12 * (x - x1);
+  sb = (signed long)dy02 * (x - x0);
+  for (; x <= x2; x++)
+  {
+    a = y1 + sa / dx12;
+    b = y0 + sb / dx02;
+    sa += dy12;
+    sb += dy02;
+    
+    if (a > b) { temp = a; a = b; b = temp; }
+    LCD_VSpan(x, a, b, state);
+  }
+  
+  // Bounding box of the three vertices, marked once
+  a = y0; b = y0;
+  if (y1 < a) a = y1;
+  if (y2 < a) a = y2;
+  if (y1 > b) b = y1;
+  if (y2 > b) b = y2;
+  LCD_MarkDirtyRect(x0, a, x2, b);
+  
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_SetArea
+* Description    : Fast fill/clear a rectangular area (optimized for page mode)
+*                  Works a whole page byte at a time, partial pages at the top
+*                  and bottom edge are masked against the framebuffer
+* Input          : x1, y1 -- top-left corner
+                   x2, y2 -- bottom-right corner
+                   state -- 1: fill all pixels, 0: clear all pixels
+* Output         : None
+* Return         : 0 -- failure, 1 -- success
+*******************************************************************************/
+unsigned char LCD_SetArea(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state)
+{
+  unsigned char temp;
+  
+  // Boundary check
+  if (x1 >= 128 || y1 >= 64)
+    return 0;
+  
+  if (x2 >= 128) x2 = 127;
+  if (y2 >= 64) y2 = 63;
+  
+  // Ensure proper ordering
+  if (x1 > x2) { temp = x1; x1 = x2; x2 = temp; }
+  if (y1 > y2) { temp = y1; y1 = y2; y2 = temp; }
+  
+  // Partial pages keep the framebuffer bits outside the mask
+  LCD_FillBlock(x1, y1, x2, y2, state);
+  LCD_MarkDirtyRect(x1, y1, x2, y2);
+  
+  return 1;
+}
+
+void LCD_Init(void)
+{
+#if LCD_SHIFT_CACHE && LCD_SHIFT_FRAMES > 0
+  LCD_ShiftCacheInit();
+#endif
+  STM3210E_LCD_Init();
+
+  LCD_Draw_ST_Logo();
+}
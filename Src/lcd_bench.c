@@ -0,0 +1,347 @@
+/**
+ ******************************************************************************
+ * @file    lcd_bench.c
+ * @brief   On-target LCD driver benchmarks
+ ******************************************************************************
+ *
+ * Every benchmark fills an LCD_BenchResultTypeDef with the number of
+ * operations done and the HCLK cycles they took, read from the Cortex-M3
+ * DWT cycle counter. LCD_Bench_PerSecond() turns that into a rate.
+ * Benchmarks draw on the panel; the framebuffer is resent afterwards so
+ * the previous screen content comes back.
+ *
+ ******************************************************************************
+ */
+
+#include "lcd_bench.h"
+#include <string.h>
+
+// Start the DWT cycle counter used by all benchmarks
+void LCD_Bench_Init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+// Operations per second of a measurement at the current HCLK
+unsigned long LCD_Bench_PerSecond(const LCD_BenchResultTypeDef *result) {
+    if (result->cycles == 0) return 0;
+    return (unsigned long)((unsigned long long)result->count * HAL_RCC_GetHCLKFreq() / result->cycles);
+}
+
+// Highest LCD bus access rate (accesses per second) the FSMC timing allows
+unsigned long LCD_Bench_BusLimit(void) {
+    unsigned long cycles = LCD_GetBusCycles();
+    return cycles ? HAL_RCC_GetHCLKFreq() / cycles : 0;
+}
+
+// Write throughput: push a full screen (8 pages x 128 bytes) over the bus
+// count = display data bytes written; compare the rate with
+// LCD_Bench_BusLimit() * 1024 / 1048 (1048 accesses incl. address commands)
+void LCD_Bench_FullScreenWrite(LCD_BenchResultTypeDef *result) {
+    static unsigned char pattern[LCD_WIDTH];
+    unsigned long start;
+    
+    for (unsigned char i = 0; i < LCD_WIDTH; i++) {
+        pattern[i] = (i & 1) ? 0xAA : 0x55;
+    }
+    
+    start = DWT->CYCCNT;
+    for (unsigned char page = 0; page < LCD_PAGES; page++) {
+        LCD_WritePage(page, 0, pattern, LCD_WIDTH);
+    }
+    result->cycles = DWT->CYCCNT - start;
+    result->count = LCD_PAGES * LCD_WIDTH;
+    
+    // Restore the screen from the framebuffer
+    LCD_Invalidate();
+    LCD_Flush();
+}
+
+// DMA flush throughput: resend the whole framebuffer through LCD_Flush()
+// count = display data bytes written
+void LCD_Bench_FullScreenFlush(LCD_BenchResultTypeDef *result) {
+    unsigned long start;
+    
+    LCD_FlushWait();
+    LCD_Invalidate();
+    start = DWT->CYCCNT;
+    LCD_Flush();
+    result->cycles = DWT->CYCCNT - start;
+    result->count = LCD_PAGES * LCD_WIDTH;
+}
+
+// Pre-framebuffer LCD_SetPixel, kept as the baseline of the primitive
+// benchmark: every pixel re-addresses the controller, reads the byte back
+// (dummy read + real read) and writes it again, 9 bus accesses per pixel
+static void Bench_LegacySetPixel(unsigned char x, unsigned char y, unsigned char state) {
+    unsigned char page = y / 8;
+    unsigned char data;
+    
+    if (x >= LCD_WIDTH || y >= LCD_HEIGHT) return;
+    
+    LCD_Command = Set_Page_Addr_X | page;
+    LCD_Command = Set_ColH_Addr_X | (x >> 4);
+    LCD_Command = Set_ColL_Addr_X | (x & 0x0F);
+    data = LCD_Data;  // dummy read
+    data = LCD_Data;
+    
+    if (state) data |= (1 << (y % 8));
+    else data &= ~(1 << (y % 8));
+    
+    LCD_Command = Set_Page_Addr_X | page;
+    LCD_Command = Set_ColH_Addr_X | (x >> 4);
+    LCD_Command = Set_ColL_Addr_X | (x & 0x0F);
+    LCD_Data = data;
+}
+
+// The benchmark primitive set drawn with the legacy pixel routine:
+// a full-width line, a 64x32 rectangle outline and a circle of radius 20
+static void Bench_LegacyPrimitives(void) {
+    signed short x = 0, y = 20, d = 3 - 2 * 20;
+    unsigned char i;
+    
+    for (i = 0; i < LCD_WIDTH; i++) {
+        Bench_LegacySetPixel(i, 2, 1);
+    }
+    
+    for (i = 32; i <= 95; i++) {
+        Bench_LegacySetPixel(i, 16, 1);
+        Bench_LegacySetPixel(i, 47, 1);
+    }
+    for (i = 16; i <= 47; i++) {
+        Bench_LegacySetPixel(32, i, 1);
+        Bench_LegacySetPixel(95, i, 1);
+    }
+    
+    while (y >= x) {
+        Bench_LegacySetPixel(64 + x, 32 + y, 1);
+        Bench_LegacySetPixel(64 - x, 32 + y, 1);
+        Bench_LegacySetPixel(64 + x, 32 - y, 1);
+        Bench_LegacySetPixel(64 - x, 32 - y, 1);
+        Bench_LegacySetPixel(64 + y, 32 + x, 1);
+        Bench_LegacySetPixel(64 - y, 32 + x, 1);
+        Bench_LegacySetPixel(64 + y, 32 - x, 1);
+        Bench_LegacySetPixel(64 - y, 32 - x, 1);
+        x++;
+        if (d > 0) {
+            y--;
+            d = d + 4 * (x - y) + 10;
+        } else {
+            d = d + 4 * x + 6;
+        }
+    }
+}
+
+// The same primitive set through the framebuffer primitives
+static void Bench_Primitives(void) {
+    LCD_DrawLine(0, LCD_WIDTH - 1, 2, 1);
+    LCD_DrawRect(32, 16, 95, 47, 1);
+    LCD_DrawCircle(64, 32, 20, 1);
+}
+
+// Primitive throughput before and after the framebuffer rework
+// count = primitives drawn; the framebuffer run includes one LCD_Flush()
+// per set of three primitives. Run on a blank screen, it is cleared afterwards
+void LCD_Bench_Primitives(LCD_BenchResultTypeDef *legacy, LCD_BenchResultTypeDef *framebuffer) {
+    unsigned long start;
+    unsigned char n;
+    
+    LCD_FlushWait();
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_PRIMITIVE_SETS; n++) {
+        Bench_LegacyPrimitives();
+    }
+    legacy->cycles = DWT->CYCCNT - start;
+    legacy->count = 3 * LCD_BENCH_PRIMITIVE_SETS;
+    
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_PRIMITIVE_SETS; n++) {
+        Bench_Primitives();
+        LCD_Flush();
+    }
+    framebuffer->cycles = DWT->CYCCNT - start;
+    framebuffer->count = 3 * LCD_BENCH_PRIMITIVE_SETS;
+    
+    LCD_Clear();
+}
+
+// Pre-framebuffer LCD_SetArea partial-page path, kept as the baseline of the
+// RMW-mode benchmark: every byte of a partial page is re-addressed for the
+// read and again for the write back (3 commands, 2 reads, 3 commands, 1 write)
+static void Bench_LegacySetArea(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned char state) {
+    unsigned char pageStart = y1 / 8, pageEnd = y2 / 8;
+    unsigned char data = state ? 0xFF : 0x00;
+    
+    for (unsigned char x = x1; x <= x2; x++) {
+        for (unsigned char page = pageStart; page <= pageEnd; page++) {
+            unsigned char mask = 0xFF;
+            unsigned char writeData = data;
+            if (page == pageStart) mask &= 0xFF << (y1 % 8);
+            if (page == pageEnd) mask &= 0xFF >> (7 - (y2 % 8));
+            
+            if (mask != 0xFF) {
+                unsigned char current;
+                LCD_Command = Set_Page_Addr_X | page;
+                LCD_Command = Set_ColH_Addr_X | (x >> 4);
+                LCD_Command = Set_ColL_Addr_X | (x & 0x0F);
+                current = LCD_Data;  // dummy read
+                current = LCD_Data;
+                writeData = (current & ~mask) | (data & mask);
+            }
+            
+            LCD_Command = Set_Page_Addr_X | page;
+            LCD_Command = Set_ColH_Addr_X | (x >> 4);
+            LCD_Command = Set_ColL_Addr_X | (x & 0x0F);
+            LCD_Data = writeData;
+        }
+    }
+}
+
+// Direct display RAM fills without the framebuffer, old re-addressing
+// read-modify-write against LCD_DirectSetArea() in RMW mode
+// count = rectangles drawn; every rectangle has partial top and bottom pages
+void LCD_Bench_DirectSetArea(LCD_BenchResultTypeDef *legacy, LCD_BenchResultTypeDef *rmw) {
+    unsigned long start;
+    unsigned char n;
+    
+    LCD_FlushWait();
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_RECTS; n++) {
+        Bench_LegacySetArea(8, 3, 119, 60, n & 1);
+    }
+    legacy->cycles = DWT->CYCCNT - start;
+    legacy->count = LCD_BENCH_RECTS;
+    
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_RECTS; n++) {
+        LCD_DirectSetArea(8, 3, 119, 60, n & 1);
+    }
+    rmw->cycles = DWT->CYCCNT - start;
+    rmw->count = LCD_BENCH_RECTS;
+    
+    // Restore the screen from the framebuffer
+    LCD_Invalidate();
+    LCD_Flush();
+}
+
+// Unpack a run-length encoded image (format in LCD_DrawImage()) into RAM
+static void Bench_UnpackImage(const LCD_ImageTypeDef *image, unsigned char *dst) {
+    const unsigned char *src = image->data;
+    unsigned int size = image->pages * image->width;
+    unsigned char *end = dst + size;
+    
+    if (!image->rle) {
+        memcpy(dst, src, size);
+        return;
+    }
+    while (dst < end) {
+        unsigned char c = *src++;
+        if (c & 0x80) {
+            for (c = (c & 0x7F) + 2; c > 0 && dst < end; c--) *dst++ = *src;
+            src++;
+        } else {
+            for (c = c + 1; c > 0 && dst < end; c--) *dst++ = *src++;
+        }
+    }
+}
+
+// Run-length decoding against drawing raw page bytes: the ST logo drawn with
+// LCD_DrawImage() from its compressed flash image, and blitted from an
+// unpacked copy (the raw path the logo took before it was compressed)
+// count = bytes drawn into the framebuffer; no flush, only the drawing
+void LCD_Bench_DrawImage(LCD_BenchResultTypeDef *raw, LCD_BenchResultTypeDef *rle) {
+    static unsigned char pixels[LCD_PAGES * LCD_WIDTH];
+    const LCD_ImageTypeDef *logo = &LCD_Images[IMAGE_ST_LOGO];
+    unsigned long start;
+    unsigned char n;
+    
+    Bench_UnpackImage(logo, pixels);
+    LCD_FlushWait();
+    LCD_SelectLayer(LCD_LAYER_BACKGROUND);
+    
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_IMAGES; n++) {
+        LCD_Blit(0, 0, pixels, NULL, logo->width, logo->pages, LCD_BLIT_COPY);
+    }
+    raw->cycles = DWT->CYCCNT - start;
+    raw->count = LCD_BENCH_IMAGES * logo->pages * logo->width;
+    
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_IMAGES; n++) {
+        LCD_DrawImage(0, 0, IMAGE_ST_LOGO, LCD_BLIT_COPY);
+    }
+    rle->cycles = DWT->CYCCNT - start;
+    rle->count = LCD_BENCH_IMAGES * logo->pages * logo->width;
+    
+    LCD_Clear();
+}
+
+// Blit every dino frame at the 8 rows of a page, through the shifting
+// blitter (LCD_BlitString) and through LCD_BlitSprite(), which takes the
+// pre-shifted copies when LCD_SHIFT_CACHE is on (LCD_SHIFT_CACHE_BYTES of RAM)
+// count = sprites blitted; no flush, only the drawing
+void LCD_Bench_SpriteShift(LCD_BenchResultTypeDef *shifting, LCD_BenchResultTypeDef *cached) {
+    static const LCD_SpriteIdTypeDef dino[] = {SPRITE_DINO_STAND, SPRITE_DINO_RUN, SPRITE_DINO_CROUCH};
+    unsigned long start;
+    unsigned char n, i, frame, row;
+    
+    LCD_FlushWait();
+    LCD_SelectLayer(LCD_LAYER_PLAYFIELD);
+    shifting->count = cached->count = 0;
+    
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_SHIFT_PASSES; n++) {
+        for (i = 0; i < sizeof(dino) / sizeof(dino[0]); i++) {
+            for (frame = 0; frame < LCD_Sprites[dino[i]].frames; frame++) {
+                for (row = 40; row < 48; row++) {
+                    LCD_BlitString(56, row, LCD_SpriteFrame(dino[i], frame), 2, LCD_BLIT_OR);
+                    shifting->count++;
+                }
+            }
+        }
+    }
+    shifting->cycles = DWT->CYCCNT - start;
+    
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_SHIFT_PASSES; n++) {
+        for (i = 0; i < sizeof(dino) / sizeof(dino[0]); i++) {
+            for (frame = 0; frame < LCD_Sprites[dino[i]].frames; frame++) {
+                for (row = 40; row < 48; row++) {
+                    LCD_BlitSprite(56, row, dino[i], frame, LCD_BLIT_OR);
+                    cached->count++;
+                }
+            }
+        }
+    }
+    cached->cycles = DWT->CYCCNT - start;
+    
+    LCD_Clear();
+}
+
+// Clear the whole screen the way LCD_Clear() used to (blank the layers,
+// invalidate and resend every page through the compositor and the flush)
+// and with LCD_ClearPages(), which fills display RAM by DMA from one zero
+// byte while the CPU blanks the RAM copies
+// count = screens cleared
+void LCD_Bench_Clear(LCD_BenchResultTypeDef *flush, LCD_BenchResultTypeDef *fill) {
+    unsigned long start;
+    unsigned char n;
+    
+    LCD_FlushWait();
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_CLEARS; n++) {
+        LCD_ClearBuffer();
+        LCD_Invalidate();
+        LCD_Flush();
+    }
+    flush->cycles = DWT->CYCCNT - start;
+    flush->count = LCD_BENCH_CLEARS;
+    
+    start = DWT->CYCCNT;
+    for (n = 0; n < LCD_BENCH_CLEARS; n++) {
+        LCD_ClearPages(0, LCD_PAGES - 1);
+    }
+    fill->cycles = DWT->CYCCNT - start;
+    fill->count = LCD_BENCH_CLEARS;
+}
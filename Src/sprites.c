@@ -0,0 +1,409 @@
+/* Generated by Tools/spritec.py from Tools/assets/font.txt, Tools/assets/sprites.txt, Tools/assets/logo.txt, Tools/assets/hud_font.txt, do not edit */
+#include "sprites.h"
+
+const unsigned char ChineseTable[][16] = {
+/*--  0: D0  --*/
+{0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x0F,0x10,0x20,0x20,0x10,0x0F,0x00},
+/*--  1: D1  --*/
+{0x00,0x10,0x10,0xF8,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},
+/*--  2: D2  --*/
+{0x00,0x70,0x08,0x08,0x08,0x88,0x70,0x00,0x00,0x30,0x28,0x24,0x22,0x21,0x30,0x00},
+/*--  3: D3  --*/
+{0x00,0x30,0x08,0x88,0x88,0x48,0x30,0x00,0x00,0x18,0x20,0x20,0x20,0x11,0x0E,0x00},
+/*--  4: D4  --*/
+{0x00,0x00,0xC0,0x20,0x10,0xF8,0x00,0x00,0x00,0x07,0x04,0x24,0x24,0x3F,0x24,0x00},
+/*--  5: D5  --*/
+{0x00,0xF8,0x08,0x88,0x88,0x08,0x08,0x00,0x00,0x19,0x21,0x20,0x20,0x11,0x0E,0x00},
+/*--  6: D6  --*/
+{0x00,0xE0,0x10,0x88,0x88,0x18,0x00,0x00,0x00,0x0F,0x11,0x20,0x20,0x11,0x0E,0x00},
+/*--  7: D7  --*/
+{0x00,0x38,0x08,0x08,0xC8,0x38,0x08,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00},
+/*--  8: D8  --*/
+{0x00,0x70,0x88,0x08,0x08,0x88,0x70,0x00,0x00,0x1C,0x22,0x21,0x21,0x22,0x1C,0x00},
+/*--  9: D9  --*/
+{0x00,0xE0,0x10,0x08,0x08,0x10,0xE0,0x00,0x00,0x00,0x31,0x22,0x22,0x11,0x0F,0x00},
+/*--  10: DPoint  --*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x00},
+/*--  11: DDash  --*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01},
+/*--  12: DColon  --*/
+{0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00},
+/*--  13: DSpace  --*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+/*--  14: Da  --*/
+{0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x19,0x24,0x22,0x22,0x22,0x3F,0x20},
+/*--  15: Db  --*/
+{0x08,0xF8,0x00,0x80,0x80,0x00,0x00,0x00,0x00,0x3F,0x11,0x20,0x20,0x11,0x0E,0x00},
+/*--  16: Dc  --*/
+{0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x0E,0x11,0x20,0x20,0x20,0x11,0x00},
+/*--  17: Dd  --*/
+{0x00,0x00,0x00,0x80,0x80,0x88,0xF8,0x00,0x00,0x0E,0x11,0x20,0x20,0x10,0x3F,0x20},
+/*--  18: De  --*/
+{0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x1F,0x22,0x22,0x22,0x22,0x13,0x00},
+/*--  19: Df  --*/
+{0x00,0x80,0x80,0xF0,0x88,0x88,0x88,0x18,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},
+/*--  20: Dg  --*/
+{0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x6B,0x94,0x94,0x94,0x93,0x60,0x00},
+/*--  21: Dh  --*/
+{0x08,0xF8,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20},
+/*--  22: Di  --*/
+{0x00,0x80,0x98,0x98,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},
+/*--  23: Dj  --*/
+{0x00,0x00,0x00,0x80,0x98,0x98,0x00,0x00,0x00,0xC0,0x80,0x80,0x80,0x7F,0x00,0x00},
+/*--  24: Dk  --*/
+{0x08,0xF8,0x00,0x00,0x80,0x80,0x80,0x00,0x20,0x3F,0x24,0x02,0x2D,0x30,0x20,0x00},
+/*--  25: Dl  --*/
+{0x00,0x08,0x08,0xF8,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},
+/*--  26: Dm  --*/
+{0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x20,0x3F,0x20,0x00,0x3F,0x20,0x00,0x3F},
+/*--  27: Dn  --*/
+{0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20},
+/*--  28: Do  --*/
+{0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x1F,0x20,0x20,0x20,0x20,0x1F,0x00},
+/*--  29: Dp  --*/
+{0x80,0x80,0x00,0x80,0x80,0x00,0x00,0x00,0x80,0xFF,0xA1,0x20,0x20,0x11,0x0E,0x00},
+/*--  30: Dq  --*/
+{0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x0E,0x11,0x20,0x20,0xA0,0xFF,0x80},
+/*--  31: Dr  --*/
+{0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x20,0x20,0x3F,0x21,0x20,0x00,0x01,0x00},
+/*--  32: Ds  --*/
+{0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x33,0x24,0x24,0x24,0x24,0x19,0x00},
+/*--  33: Dt  --*/
+{0x00,0x80,0x80,0xE0,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x1F,0x20,0x20,0x00,0x00},
+/*--  34: Du  --*/
+{0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x1F,0x20,0x20,0x20,0x10,0x3F,0x20},
+/*--  35: Dv  --*/
+{0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x01,0x0E,0x30,0x08,0x06,0x01,0x00},
+/*--  36: Dw  --*/
+{0x80,0x80,0x00,0x80,0x00,0x80,0x80,0x80,0x0F,0x30,0x0C,0x03,0x0C,0x30,0x0F,0x00},
+/*--  37: Dx  --*/
+{0x00,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x20,0x31,0x2E,0x0E,0x31,0x20,0x00},
+/*--  38: Dy  --*/
+{0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x80,0x81,0x8E,0x70,0x18,0x06,0x01,0x00},
+/*--  39: Dz  --*/
+{0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x21,0x30,0x2C,0x22,0x21,0x30,0x00},
+/*--  40: DA  --*/
+{0x00,0x00,0xC0,0x38,0xE0,0x00,0x00,0x00,0x20,0x3C,0x23,0x02,0x02,0x27,0x38,0x20},
+/*--  41: DB  --*/
+{0x08,0xF8,0x88,0x88,0x88,0x70,0x00,0x00,0x20,0x3F,0x20,0x20,0x20,0x11,0x0E,0x00},
+/*--  42: DC  --*/
+{0xC0,0x30,0x08,0x08,0x08,0x08,0x38,0x00,0x07,0x18,0x20,0x20,0x20,0x10,0x08,0x00},
+/*--  43: DD  --*/
+{0x08,0xF8,0x08,0x08,0x08,0x10,0xE0,0x00,0x20,0x3F,0x20,0x20,0x20,0x10,0x0F,0x00},
+/*--  44: DE  --*/
+{0x08,0xF8,0x88,0x88,0xE8,0x08,0x10,0x00,0x20,0x3F,0x20,0x20,0x23,0x20,0x18,0x00},
+/*--  45: DF  --*/
+{0x08,0xF8,0x88,0x88,0xE8,0x08,0x10,0x00,0x20,0x3F,0x20,0x00,0x03,0x00,0x00,0x00},
+/*--  46: DG  --*/
+{0xC0,0x30,0x08,0x08,0x08,0x38,0x00,0x00,0x07,0x18,0x20,0x20,0x22,0x1E,0x02,0x00},
+/*--  47: DH  --*/
+{0x08,0xF8,0x08,0x00,0x00,0x08,0xF8,0x08,0x20,0x3F,0x21,0x01,0x01,0x21,0x3F,0x20},
+/*--  48: DI  --*/
+{0x00,0x08,0x08,0xF8,0x08,0x08,0x00,0x00,0x00,0x20,0x20,0x3F,0x20,0x20,0x00,0x00},
+/*--  49: DJ  --*/
+{0x00,0x00,0x08,0x08,0xF8,0x08,0x08,0x00,0xC0,0x80,0x80,0x80,0x7F,0x00,0x00,0x00},
+/*--  50: DK  --*/
+{0x08,0xF8,0x88,0xC0,0x28,0x18,0x08,0x00,0x20,0x3F,0x20,0x01,0x26,0x38,0x20,0x00},
+/*--  51: DL  --*/
+{0x08,0xF8,0x08,0x00,0x00,0x00,0x00,0x00,0x20,0x3F,0x20,0x20,0x20,0x20,0x30,0x00},
+/*--  52: DM  --*/
+{0x08,0xF8,0xF8,0x00,0xF8,0xF8,0x08,0x00,0x20,0x3F,0x00,0x3F,0x00,0x3F,0x20,0x00},
+/*--  53: DN  --*/
+{0x08,0xF8,0x30,0xC0,0x00,0x08,0xF8,0x08,0x20,0x3F,0x20,0x00,0x07,0x18,0x3F,0x00},
+/*--  54: DO  --*/
+{0xE0,0x10,0x08,0x08,0x08,0x10,0xE0,0x00,0x0F,0x10,0x20,0x20,0x20,0x10,0x0F,0x00},
+/*--  55: DP  --*/
+{0x08,0xF8,0x08,0x08,0x08,0x08,0xF0,0x00,0x20,0x3F,0x21,0x01,0x01,0x01,0x00,0x00},
+/*--  56: DQ  --*/
+{0xE0,0x10,0x08,0x08,0x08,0x10,0xE0,0x00,0x0F,0x18,0x24,0x24,0x38,0x50,0x4F,0x00},
+/*--  57: DR  --*/
+{0x08,0xF8,0x88,0x88,0x88,0x88,0x70,0x00,0x20,0x3F,0x20,0x00,0x03,0x0C,0x30,0x20},
+/*--  58: DS  --*/
+{0x00,0x70,0x88,0x08,0x08,0x08,0x38,0x00,0x00,0x38,0x20,0x21,0x21,0x22,0x1C,0x00},
+/*--  59: DT  --*/
+{0x18,0x08,0x08,0xF8,0x08,0x08,0x18,0x00,0x00,0x00,0x20,0x3F,0x20,0x00,0x00,0x00},
+/*--  60: DU  --*/
+{0x08,0xF8,0x08,0x00,0x00,0x08,0xF8,0x08,0x00,0x1F,0x20,0x20,0x20,0x20,0x1F,0x00},
+/*--  61: DV  --*/
+{0x08,0x78,0x88,0x00,0x00,0xC8,0x38,0x08,0x00,0x00,0x07,0x38,0x0E,0x01,0x00,0x00},
+/*--  62: DW  --*/
+{0xF8,0x08,0x00,0xF8,0x00,0x08,0xF8,0x00,0x03,0x3C,0x07,0x00,0x07,0x3C,0x03,0x00},
+/*--  63: DX  --*/
+{0x08,0x18,0x68,0x80,0x80,0x68,0x18,0x08,0x20,0x30,0x2C,0x03,0x03,0x2C,0x30,0x20},
+/*--  64: DY  --*/
+{0x08,0x38,0xC8,0x00,0xC8,0x38,0x08,0x00,0x00,0x00,0x20,0x3F,0x20,0x00,0x00,0x00},
+/*--  65: DZ  --*/
+{0x10,0x08,0x08,0x08,0xC8,0x38,0x08,0x00,0x20,0x38,0x26,0x21,0x20,0x20,0x18,0x00},
+/*--  66: HUD_HI  --*/
+{0x3E,0x08,0x3E,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+/*--  67: CACTUS_BIG.0  --*/
+{0xC0,0xC0,0xFE,0xFE,0x60,0x38,0x80,0x00,0x07,0x07,0xFF,0xFF,0x00,0x0E,0xFF,0x18},
+/*--  68: CACTUS_BIG.1  --*/
+{0x78,0xFC,0x80,0xFF,0xFF,0x00,0xF0,0xF0,0x0E,0x00,0x01,0xFF,0xFF,0x06,0x03,0x01},
+/*--  69: CACTUS_SMALL.0  --*/
+{0x70,0x80,0x80,0xFF,0x00,0x00,0xF8,0xF8,0x00,0x00,0x00,0xFF,0x06,0x04,0x03,0x01},
+/*--  70: DINO_STAND.0 DINO_HIT.0  --*/
+{0x00,0xE0,0x80,0x00,0x00,0x80,0xC0,0xFE,0x00,0x03,0x07,0x0F,0xFF,0xBF,0x3F,0x3F},
+/*--  71: DINO_STAND.1  --*/
+{0xFF,0xFB,0xFF,0xFF,0x2F,0x2F,0x0E,0x00,0xFF,0x8F,0x07,0x01,0x01,0x03,0x00,0x00},
+/*--  72: DINO_RUN.0  --*/
+{0x00,0xF8,0xC0,0x00,0x00,0x80,0xC0,0xFE,0x00,0x03,0x07,0x0F,0x7F,0x5F,0x1F,0x1F},
+/*--  73: DINO_RUN.1  --*/
+{0xFF,0xFB,0xFF,0xFF,0x2F,0x2F,0x0E,0x00,0xFF,0x9F,0x07,0x01,0x01,0x03,0x00,0x00},
+/*--  74: DINO_RUN.2  --*/
+{0x00,0xF8,0xC0,0x00,0x00,0x80,0xC0,0xFE,0x00,0x03,0x07,0x0F,0xFF,0x9F,0x1F,0x1F},
+/*--  75: DINO_RUN.3  --*/
+{0xFF,0xFB,0xFF,0xFF,0x2F,0x2F,0x0E,0x00,0x7F,0x5F,0x07,0x01,0x01,0x03,0x00,0x00},
+/*--  76: DINO_CROUCH.0  --*/
+{0xFC,0xE0,0xC0,0x80,0x80,0x80,0x80,0x80,0x07,0x0F,0x1F,0x7F,0x5F,0x1F,0x1F,0xFF},
+/*--  77: DINO_CROUCH.1  --*/
+{0xC0,0xE0,0x60,0xE0,0xE0,0xE0,0xE0,0xC0,0x8F,0x3F,0x2F,0x0F,0x0F,0x0B,0x0B,0x03},
+/*--  78: DINO_CROUCH.2  --*/
+{0xFC,0xE0,0xC0,0x80,0x80,0x80,0x80,0x80,0x07,0x0F,0x1F,0xFF,0x9F,0x1F,0x1F,0x7F},
+/*--  79: DINO_CROUCH.3  --*/
+{0xC0,0xE0,0x60,0xE0,0xE0,0xE0,0xE0,0xC0,0x4F,0x3F,0x2F,0x0F,0x0F,0x0B,0x0B,0x03},
+/*--  80: DINO_HIT.1  --*/
+{0xF1,0xF5,0xF1,0xFF,0x2F,0x2F,0x0E,0x00,0xFF,0x8F,0x07,0x01,0x01,0x03,0x00,0x00},
+/*--  81: DINO_DEAD.0  --*/
+{0x80,0x00,0x00,0x00,0x00,0x02,0x0E,0x02,0xFF,0xF8,0xF0,0xE0,0xE0,0xE0,0xF0,0xF0},
+/*--  82: DINO_DEAD.1  --*/
+{0x08,0x06,0x08,0x02,0x0E,0x02,0x00,0x00,0xF8,0x8C,0xAC,0x8C,0xFC,0xBC,0xBC,0x38},
+/*--  83: BIRD_FLY.0  --*/
+{0x00,0x00,0x00,0x80,0xC0,0x80,0x00,0xF8,0x00,0x02,0x03,0x03,0x03,0x07,0x07,0x07},
+/*--  84: BIRD_FLY.1  --*/
+{0xE0,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x06,0x06,0x02,0x00},
+/*--  85: BIRD_FLY.2  --*/
+{0x00,0x00,0x00,0x80,0xC0,0x80,0x00,0x00,0x00,0x02,0x03,0x03,0x03,0x07,0x07,0xFF},
+/*--  86: BIRD_FLY.3  --*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x1F,0x0F,0x07,0x06,0x06,0x02,0x00},
+/*--  87: STAR.0  --*/
+{0x00,0x00,0x40,0x40,0xC0,0x40,0x40,0x38,0x00,0x00,0x00,0x00,0x20,0x1F,0x10,0x08},
+/*--  88: STAR.1  --*/
+{0x06,0x38,0x40,0x40,0xC0,0x40,0x40,0x00,0x04,0x08,0x10,0x1F,0x20,0x00,0x00,0x00},
+/*--  89: MOON.0  --*/
+{0xE0,0x10,0x0C,0x04,0x02,0xC1,0x31,0x09,0x07,0x08,0x30,0x20,0x40,0x83,0x8C,0x90},
+/*--  90: MOON.1  --*/
+{0x05,0x05,0x03,0x02,0x00,0x00,0x00,0x00,0xA0,0xA0,0xC0,0x00,0x00,0x00,0x00,0x00},
+/*--  91: CLOUD.0  --*/
+{0x00,0x00,0x80,0x40,0x40,0x20,0x10,0x10,0x00,0x03,0x04,0x08,0x08,0x08,0x08,0x10},
+/*--  92: CLOUD.1  --*/
+{0x10,0x10,0x20,0x20,0x40,0x80,0x00,0x00,0x10,0x10,0x08,0x08,0x08,0x04,0x03,0x00},
+/*--  93: GROUND_LINE.0  --*/
+{0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+/*--  94: GROUND_LINE.1  --*/
+{0x08,0x28,0x28,0x08,0x08,0x08,0xE8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+/*--  95: GROUND_LINE.2  --*/
+{0x08,0x08,0x10,0x10,0x10,0x10,0x10,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+/*--  96: GROUND_LINE.3  --*/
+{0x08,0x28,0x28,0x08,0x48,0x08,0x28,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+};
+
+/*glyphs of every sprite frame, left to right, frames one after the other*/
+const unsigned char LCD_SpriteGlyphs[] = {
+  67,68,   // CACTUS_BIG
+  69,   // CACTUS_SMALL
+  70,71,   // DINO_STAND
+  72,73,74,75,   // DINO_RUN
+  76,77,78,79,   // DINO_CROUCH
+  70,80,   // DINO_HIT
+  81,82,   // DINO_DEAD
+  83,84,85,86,   // BIRD_FLY
+  87,88,   // STAR
+  89,90,   // MOON
+  91,92,   // CLOUD
+  93,94,95,96,   // GROUND_LINE
+};
+
+const LCD_SpriteTypeDef LCD_Sprites[] = {
+  { 16, 16, 1,   0, { 0,  0, 15, 15}, 0xFF},   // SPRITE_CACTUS_BIG
+  {  8, 16, 1,   2, { 0,  0,  7, 15}, 0xFF},   // SPRITE_CACTUS_SMALL
+  { 16, 16, 1,   3, { 1,  0, 14, 15},    0},   // SPRITE_DINO_STAND
+  { 16, 16, 2,   5, { 1,  0, 14, 15},    1},   // SPRITE_DINO_RUN
+  { 16, 16, 2,   9, { 0,  5, 15, 15},    3},   // SPRITE_DINO_CROUCH
+  { 16, 16, 1,  13, { 1,  0, 14, 15}, 0xFF},   // SPRITE_DINO_HIT
+  { 16, 16, 1,  15, { 0,  1, 15, 15}, 0xFF},   // SPRITE_DINO_DEAD
+  { 16, 16, 2,  17, { 1,  3, 14, 11}, 0xFF},   // SPRITE_BIRD_FLY
+  { 16, 16, 1,  21, { 2,  1, 14, 13}, 0xFF},   // SPRITE_STAR
+  { 16, 16, 1,  23, { 0,  0, 11, 15}, 0xFF},   // SPRITE_MOON
+  { 16, 16, 1,  25, { 1,  4, 14, 12}, 0xFF},   // SPRITE_CLOUD
+  {  8, 16, 4,  27, { 0,  3,  7,  7}, 0xFF},   // SPRITE_GROUND_LINE
+};
+
+/*--  ST_LOGO: 210 bytes, run-length encoded from 1024  --*/
+static const unsigned char ST_LOGO_Data[] = {
+0x93,0x00,0x06,0x80,0xC0,0xC0,0xE0,0xF0,0xF8,0xF8,0xD4,0xFC,0x01,0x7C,0x0C,0x9C,
+0x00,0x02,0xF8,0xFC,0xFE,0x88,0xFF,0x01,0x7F,0x7F,0xA8,0x3F,0x00,0xBF,0x8C,0xFF,
+0x00,0x7F,0x93,0x3F,0x01,0x0F,0x01,0x9E,0x00,0x03,0x07,0x1F,0x3F,0x7F,0x87,0xFF,
+0x06,0xFE,0xFC,0xF8,0xF0,0xC0,0xC0,0x80,0xA1,0x00,0x01,0xC0,0xF8,0x89,0xFF,0x02,
+0x7F,0x1F,0x03,0xBC,0x00,0x06,0x01,0x03,0x07,0x0F,0x1F,0x3F,0x7F,0x87,0xFF,0x06,
+0xFE,0xFC,0xF8,0xF0,0xE0,0xC0,0x80,0x95,0x00,0x02,0x80,0xF0,0xFC,0x88,0xFF,0x02,
+0x7F,0x3F,0x07,0xC8,0x00,0x06,0x01,0x03,0x07,0x0F,0x1F,0x3F,0x7F,0x87,0xFF,0x06,
+0xFE,0xFC,0xF8,0xF0,0xE0,0xC0,0x80,0x8A,0x00,0x02,0xC0,0xF8,0xFE,0x88,0xFF,0x02,
+0x7F,0x07,0x01,0xD3,0x00,0x04,0x01,0x03,0x07,0x0F,0x3F,0x89,0xFF,0x01,0xFE,0xF8,
+0x83,0x00,0x03,0x80,0xF0,0xFC,0xFE,0x87,0xFF,0x02,0x7F,0x07,0x03,0xB2,0x00,0x01,
+0x80,0xE0,0xA4,0xF8,0x01,0xFC,0xFE,0x88,0xFF,0x07,0x3F,0x07,0x01,0x00,0x80,0xC0,
+0xF8,0xFC,0x88,0xFF,0x02,0x0F,0x07,0x01,0xB3,0x00,0x01,0x40,0x78,0xAC,0x7F,0x09,
+0x3F,0x1F,0x0F,0x07,0x03,0x00,0x00,0x40,0x60,0x7C,0x88,0x7F,0x02,0x1F,0x0F,0x03,
+0xB7,0x00,
+};
+
+const LCD_ImageTypeDef LCD_Images[] = {
+  {128, 8, 1, ST_LOGO_Data},   // IMAGE_ST_LOGO
+};
+
+/*glyph of every printable ASCII character, ' ' for the ones without*/
+const unsigned char LCD_AsciiGlyphs[] = {
+  13,13,13,13,13,13,13,13,13,13,13,13,13,11,10,13,   // 0x20  !"#$%&'()*+,-./
+   0, 1, 2, 3, 4, 5, 6, 7, 8, 9,12,13,13,13,13,13,   // 0x30 0123456789:;<=>?
+  13,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,   // 0x40 @ABCDEFGHIJKLMNO
+  55,56,57,58,59,60,61,62,63,64,65,13,13,13,13,13,   // 0x50 PQRSTUVWXYZ[\]^_
+  13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,   // 0x60 `abcdefghijklmno
+  29,30,31,32,33,34,35,36,37,38,39,13,13,13,13,   // 0x70 pqrstuvwxyz{|}~
+};
+
+/*HUD font columns, glyph after glyph, bit 0 on top*/
+const unsigned char LCD_SmallFontData[] = {
+  0x00,0x00,   // ' '
+  0x3E,0x22,0x3E,   // '0'
+  0x24,0x3E,0x20,   // '1'
+  0x3A,0x2A,0x2E,   // '2'
+  0x2A,0x2A,0x3E,   // '3'
+  0x0E,0x08,0x3E,   // '4'
+  0x2E,0x2A,0x3A,   // '5'
+  0x3E,0x2A,0x3A,   // '6'
+  0x02,0x02,0x3E,   // '7'
+  0x3E,0x2A,0x3E,   // '8'
+  0x2E,0x2A,0x3E,   // '9'
+  0x3C,0x0A,0x3C,   // 'A'
+  0x3E,0x2A,0x14,   // 'B'
+  0x1C,0x22,0x22,   // 'C'
+  0x3E,0x22,0x1C,   // 'D'
+  0x3E,0x2A,0x22,   // 'E'
+  0x3E,0x0A,0x02,   // 'F'
+  0x1C,0x22,0x3A,   // 'G'
+  0x3E,0x08,0x3E,   // 'H'
+  0x3E,   // 'I'
+  0x10,0x20,0x1E,   // 'J'
+  0x3E,0x08,0x36,   // 'K'
+  0x3E,0x20,0x20,   // 'L'
+  0x3E,0x04,0x08,0x04,0x3E,   // 'M'
+  0x3E,0x04,0x08,0x3E,   // 'N'
+  0x1C,0x22,0x1C,   // 'O'
+  0x3E,0x0A,0x04,   // 'P'
+  0x1C,0x32,0x2C,   // 'Q'
+  0x3E,0x0A,0x34,   // 'R'
+  0x24,0x2A,0x12,   // 'S'
+  0x02,0x3E,0x02,   // 'T'
+  0x3E,0x20,0x3E,   // 'U'
+  0x1E,0x20,0x1E,   // 'V'
+  0x3E,0x10,0x08,0x10,0x3E,   // 'W'
+  0x36,0x08,0x36,   // 'X'
+  0x06,0x38,0x06,   // 'Y'
+  0x32,0x2A,0x26,   // 'Z'
+  0x14,   // ':'
+  0x20,   // '.'
+  0x08,0x08,0x08,   // '-'
+  0x08,0x1C,0x08,   // '+'
+  0x30,0x08,0x06,   // '/'
+  0x2E,   // '!'
+  0x02,0x2A,0x04,   // '?'
+};
+
+/*HUD font glyph of every printable ASCII character*/
+const LCD_SmallGlyphTypeDef LCD_SmallFont[] = {
+  {  0, 2},   // 0x20 ' '
+  {124, 1},   // 0x21 '!'
+  {  0, 2},   // 0x22 '"'
+  {  0, 2},   // 0x23 '#'
+  {  0, 2},   // 0x24 '$'
+  {  0, 2},   // 0x25 '%'
+  {  0, 2},   // 0x26 '&'
+  {  0, 2},   // 0x27 '''
+  {  0, 2},   // 0x28 '('
+  {  0, 2},   // 0x29 ')'
+  {  0, 2},   // 0x2A '*'
+  {118, 3},   // 0x2B '+'
+  {  0, 2},   // 0x2C ','
+  {115, 3},   // 0x2D '-'
+  {114, 1},   // 0x2E '.'
+  {121, 3},   // 0x2F '/'
+  {  2, 3},   // 0x30 '0'
+  {  5, 3},   // 0x31 '1'
+  {  8, 3},   // 0x32 '2'
+  { 11, 3},   // 0x33 '3'
+  { 14, 3},   // 0x34 '4'
+  { 17, 3},   // 0x35 '5'
+  { 20, 3},   // 0x36 '6'
+  { 23, 3},   // 0x37 '7'
+  { 26, 3},   // 0x38 '8'
+  { 29, 3},   // 0x39 '9'
+  {113, 1},   // 0x3A ':'
+  {  0, 2},   // 0x3B ';'
+  {  0, 2},   // 0x3C '<'
+  {  0, 2},   // 0x3D '='
+  {  0, 2},   // 0x3E '>'
+  {125, 3},   // 0x3F '?'
+  {  0, 2},   // 0x40 '@'
+  { 32, 3},   // 0x41 'A'
+  { 35, 3},   // 0x42 'B'
+  { 38, 3},   // 0x43 'C'
+  { 41, 3},   // 0x44 'D'
+  { 44, 3},   // 0x45 'E'
+  { 47, 3},   // 0x46 'F'
+  { 50, 3},   // 0x47 'G'
+  { 53, 3},   // 0x48 'H'
+  { 56, 1},   // 0x49 'I'
+  { 57, 3},   // 0x4A 'J'
+  { 60, 3},   // 0x4B 'K'
+  { 63, 3},   // 0x4C 'L'
+  { 66, 5},   // 0x4D 'M'
+  { 71, 4},   // 0x4E 'N'
+  { 75, 3},   // 0x4F 'O'
+  { 78, 3},   // 0x50 'P'
+  { 81, 3},   // 0x51 'Q'
+  { 84, 3},   // 0x52 'R'
+  { 87, 3},   // 0x53 'S'
+  { 90, 3},   // 0x54 'T'
+  { 93, 3},   // 0x55 'U'
+  { 96, 3},   // 0x56 'V'
+  { 99, 5},   // 0x57 'W'
+  {104, 3},   // 0x58 'X'
+  {107, 3},   // 0x59 'Y'
+  {110, 3},   // 0x5A 'Z'
+  {  0, 2},   // 0x5B '['
+  {  0, 2},   // 0x5C '\'
+  {  0, 2},   // 0x5D ']'
+  {  0, 2},   // 0x5E '^'
+  {  0, 2},   // 0x5F '_'
+  {  0, 2},   // 0x60 '`'
+  { 32, 3},   // 0x61 'a'
+  { 35, 3},   // 0x62 'b'
+  { 38, 3},   // 0x63 'c'
+  { 41, 3},   // 0x64 'd'
+  { 44, 3},   // 0x65 'e'
+  { 47, 3},   // 0x66 'f'
+  { 50, 3},   // 0x67 'g'
+  { 53, 3},   // 0x68 'h'
+  { 56, 1},   // 0x69 'i'
+  { 57, 3},   // 0x6A 'j'
+  { 60, 3},   // 0x6B 'k'
+  { 63, 3},   // 0x6C 'l'
+  { 66, 5},   // 0x6D 'm'
+  { 71, 4},   // 0x6E 'n'
+  { 75, 3},   // 0x6F 'o'
+  { 78, 3},   // 0x70 'p'
+  { 81, 3},   // 0x71 'q'
+  { 84, 3},   // 0x72 'r'
+  { 87, 3},   // 0x73 's'
+  { 90, 3},   // 0x74 't'
+  { 93, 3},   // 0x75 'u'
+  { 96, 3},   // 0x76 'v'
+  { 99, 5},   // 0x77 'w'
+  {104, 3},   // 0x78 'x'
+  {107, 3},   // 0x79 'y'
+  {110, 3},   // 0x7A 'z'
+  {  0, 2},   // 0x7B '{'
+  {  0, 2},   // 0x7C '|'
+  {  0, 2},   // 0x7D '}'
+  {  0, 2},   // 0x7E '~'
+};
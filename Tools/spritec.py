@@ -0,0 +1,663 @@
+#!/usr/bin/env python3
+"""Sprite asset compiler.
+
+Turns ASCII-art or PNG sources into the glyph tables the LCD driver draws
+from: Src/sprites.c holds the 8x16 glyphs in the ChineseTable[] layout, the
+sprite descriptors and the images, Inc/sprites.h the font macros, the sprite
+and image IDs and the descriptor types.
+
+    python3 Tools/spritec.py Tools/assets/font.txt Tools/assets/sprites.txt \
+                             Tools/assets/logo.txt Tools/assets/hud_font.txt
+
+Source format, one entry per block:
+
+    // comment
+    glyph NAME ['c']                8x16 glyph, emitted as #define NAME offset
+    sprite NAME WxH [frames=N] [hitbox=L,T,R,B] [preshift] [file=image.png]
+    image NAME WxH [rle] [file=image.png]
+    small 'c' WxH                   HUD font glyph of character c
+
+followed by H rows of W*N characters, '#' for a set pixel and '.' for a
+clear one, frames side by side. With file= the rows come from the image
+instead (dark opaque pixels are set) and the block has no rows. Sprite W is
+rounded up to a multiple of 8, H may be at most 16.
+
+Images are larger bitmaps drawn page by page with LCD_DrawImage(), H is a
+multiple of 8. With rle they are stored run-length encoded when that is
+smaller: a control byte c below 0x80 is followed by c + 1 literal bytes, c
+from 0x80 repeats the next byte (c & 0x7F) + 2 times. Runs go on across
+page ends.
+
+Every sprite frame is cut into 8x16 glyphs, one per 8 pixel column. All
+glyphs, font and sprite, are deduplicated: a column that appears in several
+sprites or frames is stored once and the descriptors point to it through
+LCD_SpriteGlyphs[].
+
+The hitbox (left, top, right, bottom pixel) goes into the sprite descriptor,
+where checkCollision() in function.c tests it; without hitbox= it is the
+bounding box of the set pixels of all frames.
+
+A glyph given a character is what the text functions draw for it:
+LCD_AsciiGlyphs[] maps the printable ASCII characters to glyph offsets, the
+ones without a glyph of their own to the glyph of ' '.
+
+Small glyphs form the proportional HUD font drawn by LCD_DrawSmallText():
+W is the glyph's own width (1-8), H at most 8 rows from the top of the page.
+Their columns are packed one after the other into LCD_SmallFontData[],
+LCD_SmallFont[] holds offset and width for every printable ASCII character.
+Lower case letters without a glyph use the upper case one, other characters
+the glyph of ' '.
+
+Sprites marked preshift get a slot in the pre-shifted sprite cache the LCD
+driver builds at startup when LCD_SHIFT_CACHE is enabled; they must be at
+most LCD_SHIFT_WIDTH (16) pixels wide.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+GLYPH_W = 8
+GLYPH_H = 16
+SHIFT_WIDTH = 16        # LCD_SHIFT_WIDTH, columns of a pre-shifted frame
+NO_SHIFT = 0xFF         # LCD_SPRITE_NOT_SHIFTED
+ASCII_FIRST = 0x20      # LCD_ASCII_FIRST, first character in LCD_AsciiGlyphs[]
+ASCII_LAST = 0x7E       # LCD_ASCII_LAST
+
+
+class AssetError(Exception):
+    pass
+
+
+class Entry:
+    def __init__(self, kind, name, width, height, frames, hitbox, source):
+        self.kind = kind        # "glyph", "sprite", "image" or "small"
+        self.name = name
+        self.width = width
+        self.height = height
+        self.frames = frames
+        self.hitbox = hitbox
+        self.source = source
+        self.image = None       # PNG file the pixels came from
+        self.char = None        # glyph, small: ASCII character it draws
+        self.rle = False        # image: store run-length encoded if smaller
+        self.preshift = False   # sprite: cache the 7 shifted copies of every frame
+        self.pixels = []        # rows of booleans, width * frames wide
+        self.glyphs = []        # glyph offsets, frame by frame, left to right
+        self.data = b""         # image: bytes as stored, small: columns
+        self.offset = 0         # small: first column in LCD_SmallFontData[]
+
+
+# --- PNG input ---------------------------------------------------------------
+
+def _unfilter(data, width, height, bpp, stride):
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        ftype = data[pos]
+        line = bytearray(data[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+            elif ftype != 0:
+                raise AssetError("bad PNG filter type %d" % ftype)
+        rows.append(line)
+        prev = line
+    return rows
+
+
+def read_png(path):
+    """Return the image as rows of booleans, True for dark opaque pixels."""
+    with open(path, "rb") as f:
+        blob = f.read()
+    if blob[:8] != b"\x89PNG\r\n\x1a\n":
+        raise AssetError("%s: not a PNG file" % path)
+
+    pos = 8
+    idat = b""
+    palette = []
+    trns = b""
+    while pos < len(blob):
+        length, ctype = struct.unpack(">I4s", blob[pos:pos + 8])
+        body = blob[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif ctype == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif ctype == b"tRNS":
+            trns = body
+        elif ctype == b"IDAT":
+            idat += body
+        elif ctype == b"IEND":
+            break
+
+    if interlace:
+        raise AssetError("%s: interlaced PNG is not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color)
+    if channels is None or (depth != 8 and color not in (0, 3)):
+        raise AssetError("%s: unsupported PNG format (color type %d, depth %d)" % (path, color, depth))
+
+    bits = channels * depth
+    stride = (width * bits + 7) // 8
+    rows = _unfilter(zlib.decompress(idat), width, height, max(1, bits // 8), stride)
+
+    image = []
+    for line in rows:
+        out = []
+        for x in range(width):
+            if depth < 8:
+                shift = 8 - depth - (x * depth) % 8
+                v = (line[x * depth // 8] >> shift) & ((1 << depth) - 1)
+            else:
+                v = None
+            if color == 0:
+                if v is None:
+                    v = line[x]
+                else:
+                    v = v * 255 // ((1 << depth) - 1)
+                rgb, alpha = (v, v, v), 255
+            elif color == 3:
+                index = line[x] if v is None else v
+                rgb = palette[index]
+                alpha = trns[index] if index < len(trns) else 255
+            elif color == 2:
+                rgb, alpha = tuple(line[3 * x:3 * x + 3]), 255
+            elif color == 4:
+                rgb, alpha = (line[2 * x],) * 3, line[2 * x + 1]
+            else:
+                rgb, alpha = tuple(line[4 * x:4 * x + 3]), line[4 * x + 3]
+            luma = (299 * rgb[0] + 587 * rgb[1] + 114 * rgb[2]) // 1000
+            out.append(alpha >= 128 and luma < 128)
+        image.append(out)
+    return image
+
+
+# --- source parsing ----------------------------------------------------------
+
+def parse_source(path):
+    entries = []
+    entry = None
+    base = os.path.dirname(path)
+
+    with open(path) as f:
+        for number, raw in enumerate(f, 1):
+            where = "%s:%d" % (path, number)
+            line = raw.split("//", 1)[0].strip()
+            if not line:
+                continue
+            words = line.split()
+
+            if words[0] in ("glyph", "sprite", "image", "small"):
+                if entry is not None:
+                    finish_entry(entry)
+                entry = parse_header(words, where, base)
+                entries.append(entry)
+            elif entry is None:
+                raise AssetError("%s: art before the first glyph, sprite, image or small" % where)
+            else:
+                if entry.image is not None:
+                    raise AssetError("%s: %s takes its pixels from an image" % (where, entry.name))
+                if len(line) != entry.width * entry.frames or set(line) - set("#."):
+                    raise AssetError("%s: expected %d characters of '#' and '.'" %
+                                     (where, entry.width * entry.frames))
+                entry.pixels.append([c == "#" for c in line])
+
+    if entry is not None:
+        finish_entry(entry)
+    return entries
+
+
+def parse_header(words, where, base):
+    if words[0] == "small":
+        match = re.match(r"'(.)' (\d+)x(\d+)$", " ".join(words[1:]))
+        if not match or not ASCII_FIRST <= ord(match.group(1)) <= ASCII_LAST:
+            raise AssetError("%s: expected small 'c' WxH, c a printable ASCII character" % where)
+        width, height = int(match.group(2)), int(match.group(3))
+        if not 0 < width <= 8 or not 0 < height <= 8:
+            raise AssetError("%s: small glyphs are 1-8 pixels wide and 1-8 high" % where)
+        entry = Entry("small", "'%s'" % match.group(1), width, height, 1, None, where)
+        entry.char = match.group(1)
+        return entry
+
+    kind, name = words[0], words[1] if len(words) > 1 else None
+    if name is None or not name.replace("_", "").isalnum():
+        raise AssetError("%s: missing or bad name" % where)
+
+    if kind == "glyph":
+        char = " ".join(words[2:])
+        entry = Entry("glyph", name, GLYPH_W, GLYPH_H, 1, None, where)
+        if char:
+            if len(char) != 3 or char[0] != "'" or char[2] != "'" or \
+               not ASCII_FIRST <= ord(char[1]) <= ASCII_LAST:
+                raise AssetError("%s: glyph NAME ['c'], c a printable ASCII character" % where)
+            entry.char = char[1]
+        return entry
+
+    try:
+        width, height = (int(v) for v in words[2].split("x"))
+    except (IndexError, ValueError):
+        raise AssetError("%s: expected %s NAME WxH" % (where, kind))
+    if kind == "image":
+        if not 0 < height <= 64 or height % 8 or not 0 < width <= 128:
+            raise AssetError("%s: images are 1-128 pixels wide and 8-64 high in pages" % where)
+    elif not 0 < height <= GLYPH_H or not 0 < width <= 255:
+        raise AssetError("%s: sprites are 1-255 pixels wide and 1-%d high" % (where, GLYPH_H))
+
+    frames, hitbox, image, rle, preshift = 1, None, None, False, False
+    for option in words[3:]:
+        key, _, value = option.partition("=")
+        if key == "frames" and kind == "sprite":
+            frames = int(value)
+        elif key == "hitbox" and kind == "sprite":
+            hitbox = [int(v) for v in value.split(",")]
+            if len(hitbox) != 4:
+                raise AssetError("%s: hitbox=L,T,R,B" % where)
+        elif key == "rle" and kind == "image":
+            rle = True
+        elif key == "preshift" and kind == "sprite":
+            if width > SHIFT_WIDTH:
+                raise AssetError("%s: preshift sprites are at most %d pixels wide" % (where, SHIFT_WIDTH))
+            preshift = True
+        elif key == "file":
+            image = os.path.join(base, value)
+        else:
+            raise AssetError("%s: unknown %s option %s" % (where, kind, key))
+
+    entry = Entry(kind, name, width, height, frames, hitbox, where)
+    entry.rle = rle
+    entry.preshift = preshift
+    if image is not None:
+        entry.image = image
+        entry.pixels = read_png(image)
+        if len(entry.pixels) != height or any(len(r) != width * frames for r in entry.pixels):
+            raise AssetError("%s: %s must be %dx%d" % (where, image, width * frames, height))
+    return entry
+
+
+def finish_entry(entry):
+    if len(entry.pixels) != entry.height:
+        raise AssetError("%s: %s has %d rows, expected %d" %
+                         (entry.source, entry.name, len(entry.pixels), entry.height))
+
+
+# --- glyph building ----------------------------------------------------------
+
+def cut_glyphs(entry):
+    """Cut every frame into 8x16 glyphs, bytes in ChineseTable[] order."""
+    cols = (entry.width + GLYPH_W - 1) // GLYPH_W
+    glyphs = []
+    for frame in range(entry.frames):
+        for col in range(cols):
+            data = bytearray(GLYPH_W * 2)
+            for x in range(GLYPH_W):
+                px = col * GLYPH_W + x
+                if px >= entry.width:
+                    continue
+                for y in range(entry.height):
+                    if entry.pixels[y][frame * entry.width + px]:
+                        data[x + GLYPH_W * (y // 8)] |= 1 << (y % 8)
+            glyphs.append(bytes(data))
+    return glyphs
+
+
+def small_columns(entry):
+    """Columns of a small glyph, one byte each, bit 0 on top."""
+    data = bytearray(entry.width)
+    for y, row in enumerate(entry.pixels):
+        for x, on in enumerate(row):
+            if on:
+                data[x] |= 1 << y
+    return bytes(data)
+
+
+def page_bytes(entry):
+    """Image bytes page by page, left to right, bit 0 on top."""
+    data = bytearray(entry.width * entry.height // 8)
+    for y, row in enumerate(entry.pixels):
+        for x, on in enumerate(row):
+            if on:
+                data[(y // 8) * entry.width + x] |= 1 << (y % 8)
+    return bytes(data)
+
+
+def rle_encode(data):
+    """Run-length encode for LCD_DrawImage(), runs of 3 or more repeat."""
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 129 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            if literal:
+                out += bytes([len(literal) - 1]) + literal
+                literal = bytearray()
+            out += bytes([0x80 | (run - 2), data[i]])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+            if len(literal) == 128:
+                out += bytes([127]) + literal
+                literal = bytearray()
+    if literal:
+        out += bytes([len(literal) - 1]) + literal
+    return bytes(out)
+
+
+def rle_decode(data, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        c = data[i]
+        if c & 0x80:
+            out += bytes([data[i + 1]]) * ((c & 0x7F) + 2)
+            i += 2
+        else:
+            out += data[i + 1:i + 2 + c]
+            i += 2 + c
+    return bytes(out[:size])
+
+
+def bounding_box(entry):
+    xs, ys = [], []
+    for y, row in enumerate(entry.pixels):
+        for x, on in enumerate(row):
+            if on:
+                xs.append(x % entry.width)
+                ys.append(y)
+    if not xs:
+        return [0, 0, 0, 0]
+    return [min(xs), min(ys), max(xs), max(ys)]
+
+
+def build(entries):
+    table = []          # glyph bytes by offset
+    offsets = {}        # glyph bytes -> offset
+    users = []          # names using each glyph, for the comments
+    total = 0
+
+    for entry in entries:
+        if entry.kind == "small":
+            entry.data = small_columns(entry)
+            continue
+        if entry.kind == "image":
+            raw = page_bytes(entry)
+            entry.data = raw
+            if entry.rle:
+                packed = rle_encode(raw)
+                assert rle_decode(packed, len(raw)) == raw
+                entry.rle = len(packed) < len(raw)
+                if entry.rle:
+                    entry.data = packed
+            continue
+        for n, data in enumerate(cut_glyphs(entry)):
+            total += 1
+            if data not in offsets:
+                offsets[data] = len(table)
+                table.append(data)
+                users.append([])
+            offset = offsets[data]
+            users[offset].append(entry.name if entry.kind == "glyph" else "%s.%d" % (entry.name, n))
+            entry.glyphs.append(offset)
+        if entry.kind != "glyph" and entry.hitbox is None:
+            entry.hitbox = bounding_box(entry)
+
+    if len(table) > 256:
+        raise AssetError("%d glyphs, glyph offsets are one byte" % len(table))
+    return table, users, total
+
+
+# --- output ------------------------------------------------------------------
+
+def write_header(path, entries, table, sources):
+    glyphs = [e for e in entries if e.kind == "glyph"]
+    sprites = [e for e in entries if e.kind == "sprite"]
+    images = [e for e in entries if e.kind == "image"]
+    guard = "__" + os.path.basename(path).upper().replace(".", "_")
+    width = max(len(e.name) for e in glyphs) if glyphs else 0
+
+    out = []
+    out.append("/* Generated by Tools/spritec.py from %s, do not edit */" % ", ".join(sources))
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("/*sprite descriptor, see LCD_BlitSprite()*/")
+    out.append("typedef struct")
+    out.append("{")
+    out.append("  unsigned char width;      // pixels, drawn as width/8 glyphs rounded up")
+    out.append("  unsigned char height;     // pixels, at most 16")
+    out.append("  unsigned char frames;     // animation frames")
+    out.append("  unsigned char glyphs;     // first entry of frame 0 in LCD_SpriteGlyphs[]")
+    out.append("  unsigned char hitbox[4];  // collision box: left, top, right, bottom pixel")
+    out.append("  unsigned char shifted;    // frame 0 in the shift cache, LCD_SPRITE_NOT_SHIFTED: none")
+    out.append("} LCD_SpriteTypeDef;")
+    out.append("")
+    out.append("/*pre-shifted sprite frames (preshift in the assets), see LCD_SHIFT_CACHE*/")
+    out.append("#define LCD_SHIFT_FRAMES        %d" % sum(e.frames for e in sprites if e.preshift))
+    out.append("#define LCD_SHIFT_WIDTH         %d" % SHIFT_WIDTH)
+    out.append("#define LCD_SPRITE_NOT_SHIFTED  0x%02X" % NO_SHIFT)
+    out.append("")
+    out.append("/*image descriptor, see LCD_DrawImage()*/")
+    out.append("typedef struct")
+    out.append("{")
+    out.append("  unsigned char width;        // pixels")
+    out.append("  unsigned char pages;        // height in pages of 8 rows")
+    out.append("  unsigned char rle;          // 1: data is run-length encoded, see Tools/spritec.py")
+    out.append("  const unsigned char *data;  // page by page, left to right, bit 0 on top")
+    out.append("} LCD_ImageTypeDef;")
+    out.append("")
+    out.append("/*HUD font glyph, see LCD_DrawSmallText()*/")
+    out.append("typedef struct")
+    out.append("{")
+    out.append("  unsigned char offset;  // first column in LCD_SmallFontData[]")
+    out.append("  unsigned char width;   // columns, drawn with one blank column after them")
+    out.append("} LCD_SmallGlyphTypeDef;")
+    out.append("")
+    out.append("/*font glyphs, offsets in ChineseTable[]*/")
+    for e in glyphs:
+        out.append("#define %-*s %d" % (width, e.name, e.glyphs[0]))
+    out.append("")
+    out.append("/*sprite IDs, index of the descriptor in LCD_Sprites[]*/")
+    out.append("typedef enum")
+    out.append("{")
+    items = ["SPRITE_%s%s," % (e.name, " = 0" if n == 0 else "") for n, e in enumerate(sprites)]
+    pad = max(len(i) for i in items) if items else 0
+    for item, e in zip(items, sprites):
+        out.append(("  %-*s  // %d frames" % (pad, item, e.frames) if e.frames > 1 else "  " + item))
+    out.append("  SPRITE_COUNT")
+    out.append("} LCD_SpriteIdTypeDef;")
+    out.append("")
+    out.append("/*image IDs, index of the descriptor in LCD_Images[]*/")
+    out.append("typedef enum")
+    out.append("{")
+    for n, e in enumerate(images):
+        out.append("  IMAGE_%s%s," % (e.name, " = 0" if n == 0 else ""))
+    out.append("  IMAGE_COUNT")
+    out.append("} LCD_ImageIdTypeDef;")
+    out.append("")
+    out.append("#define LCD_GLYPH_COUNT  %d" % len(table))
+    out.append("")
+    out.append("/*printable ASCII characters in LCD_AsciiGlyphs[]*/")
+    out.append("#define LCD_ASCII_FIRST  0x%02X" % ASCII_FIRST)
+    out.append("#define LCD_ASCII_LAST   0x%02X" % ASCII_LAST)
+    out.append("")
+    out.append("extern const unsigned char ChineseTable[][16];")
+    out.append("extern const unsigned char LCD_SpriteGlyphs[];")
+    out.append("extern const LCD_SpriteTypeDef LCD_Sprites[];")
+    out.append("extern const LCD_ImageTypeDef LCD_Images[];")
+    out.append("extern const unsigned char LCD_AsciiGlyphs[];")
+    out.append("extern const unsigned char LCD_SmallFontData[];")
+    out.append("extern const LCD_SmallGlyphTypeDef LCD_SmallFont[];")
+    out.append("")
+    out.append("#endif /* %s */" % guard)
+    return out
+
+
+def write_source(path, header, entries, table, users, sources):
+    sprites = [e for e in entries if e.kind == "sprite"]
+    images = [e for e in entries if e.kind == "image"]
+
+    out = []
+    out.append("/* Generated by Tools/spritec.py from %s, do not edit */" % ", ".join(sources))
+    out.append('#include "%s"' % os.path.basename(header))
+    out.append("")
+    out.append("const unsigned char ChineseTable[][16] = {")
+    for offset, data in enumerate(table):
+        out.append("/*--  %d: %s  --*/" % (offset, " ".join(users[offset])))
+        out.append("{" + ",".join("0x%02X" % b for b in data) + "},")
+    out.append("};")
+    out.append("")
+    out.append("/*glyphs of every sprite frame, left to right, frames one after the other*/")
+    out.append("const unsigned char LCD_SpriteGlyphs[] = {")
+    for e in sprites:
+        out.append("  " + ",".join(str(g) for g in e.glyphs) + ",   // " + e.name)
+    out.append("};")
+    out.append("")
+    out.append("const LCD_SpriteTypeDef LCD_Sprites[] = {")
+    first = shifted = 0
+    for e in sprites:
+        out.append("  {%3d, %2d, %d, %3d, {%2d, %2d, %2d, %2d}, %s},   // SPRITE_%s" %
+                   (e.width, e.height, e.frames, first, e.hitbox[0], e.hitbox[1],
+                    e.hitbox[2], e.hitbox[3], "%4d" % shifted if e.preshift else "0x%02X" % NO_SHIFT,
+                    e.name))
+        first += len(e.glyphs)
+        shifted += e.frames if e.preshift else 0
+    out.append("};")
+    if first > 256:
+        raise AssetError("%d sprite glyph entries, descriptors hold one byte offsets" % first)
+
+    for e in images:
+        out.append("")
+        out.append("/*--  %s: %d bytes%s  --*/" % (e.name, len(e.data),
+                   ", run-length encoded from %d" % (e.width * e.height // 8) if e.rle else ""))
+        out.append("static const unsigned char %s_Data[] = {" % e.name)
+        for i in range(0, len(e.data), 16):
+            out.append(",".join("0x%02X" % b for b in e.data[i:i + 16]) + ",")
+        out.append("};")
+    out.append("")
+    out.append("const LCD_ImageTypeDef LCD_Images[] = {")
+    for e in images:
+        out.append("  {%3d, %d, %d, %s_Data},   // IMAGE_%s" %
+                   (e.width, e.height // 8, e.rle, e.name, e.name))
+    if not images:
+        out.append("  {0, 0, 0, 0}")
+    out.append("};")
+
+    chars = {}
+    for e in entries:
+        if e.kind == "glyph" and e.char is not None:
+            if e.char in chars:
+                raise AssetError("%s: '%s' already drawn by %s" % (e.source, e.char, chars[e.char].name))
+            chars[e.char] = e
+    blank = chars[" "].glyphs[0] if " " in chars else 0
+    out.append("")
+    out.append("/*glyph of every printable ASCII character, ' ' for the ones without*/")
+    out.append("const unsigned char LCD_AsciiGlyphs[] = {")
+    for first in range(ASCII_FIRST, ASCII_LAST + 1, 16):
+        codes = range(first, min(first + 16, ASCII_LAST + 1))
+        out.append("  " + ",".join("%2d" % (chars[chr(c)].glyphs[0] if chr(c) in chars else blank)
+                                   for c in codes) +
+                   ",   // 0x%02X %s" % (first, "".join(chr(c) for c in codes)))
+    out.append("};")
+
+    small = dict((e.char, e) for e in entries if e.kind == "small")
+    out.append("")
+    out.append("/*HUD font columns, glyph after glyph, bit 0 on top*/")
+    out.append("const unsigned char LCD_SmallFontData[] = {")
+    offset = 0
+    for e in small.values():
+        e.offset = offset
+        offset += len(e.data)
+        out.append("  " + ",".join("0x%02X" % b for b in e.data) + ",   // " + e.name)
+    if not small:
+        out.append("  0")
+    out.append("};")
+    if offset > 256:
+        raise AssetError("%d bytes of small glyphs, LCD_SmallFont[] holds one byte offsets" % offset)
+    out.append("")
+    out.append("/*HUD font glyph of every printable ASCII character*/")
+    out.append("const LCD_SmallGlyphTypeDef LCD_SmallFont[] = {")
+    for code in range(ASCII_FIRST, ASCII_LAST + 1):
+        c = chr(code)
+        e = small.get(c) or small.get(c.upper()) or small.get(" ")
+        out.append("  {%3d, %d},   // 0x%02X '%s'" % (e.offset if e else 0, e.width if e else 0, code, c))
+    out.append("};")
+    return out
+
+
+def write_lines(path, lines):
+    text = "\n".join(lines) + "\n"
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description="Compile sprite art into LCD glyph tables.")
+    parser.add_argument("sources", nargs="+", help="asset files, font glyphs first")
+    parser.add_argument("--header", default=os.path.join(root, "Inc", "sprites.h"))
+    parser.add_argument("--source", default=os.path.join(root, "Src", "sprites.c"))
+    args = parser.parse_args()
+
+    try:
+        entries = []
+        for path in args.sources:
+            entries += parse_source(path)
+        names = [e.name for e in entries]
+        for name in names:
+            if names.count(name) > 1:
+                raise AssetError("%s is defined more than once" % name)
+
+        table, users, total = build(entries)
+        sources = [os.path.relpath(p, root).replace(os.sep, "/") for p in args.sources]
+        header = write_header(args.header, entries, table, sources)
+        source = write_source(args.source, args.header, entries, table, users, sources)
+    except (AssetError, OSError) as err:
+        sys.stderr.write("spritec: %s\n" % err)
+        return 1
+
+    write_lines(args.header, header)
+    write_lines(args.source, source)
+    print("%d glyphs (%d bytes) from %d, %d sprites" %
+          (len(table), len(table) * 16, total, len([e for e in entries if e.kind == "sprite"])))
+    small = [e for e in entries if e.kind == "small"]
+    if small:
+        print("%d small glyphs (%d bytes)" % (len(small), sum(len(e.data) for e in small)))
+    packed = len(rle_encode(b"".join(table)))
+    print("  the glyph table would pack to %d bytes (%d%%) with RLE, it stays raw for the blitter" %
+          (packed, 100 * packed // max(1, len(table) * 16)))
+    for e in entries:
+        if e.kind == "image":
+            raw = e.width * e.height // 8
+            print("%s: %d bytes, %s %d%% of %d" % (e.name, len(e.data),
+                  "run-length encoded," if e.rle else "raw,", 100 * len(e.data) // raw, raw))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())